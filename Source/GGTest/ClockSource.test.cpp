@@ -0,0 +1,64 @@
+#include "CoreMinimal.h"
+#include "GoogleTestApp.h"
+#include "NansTimelineSystemCore/Public/ClockSource.h"
+#include "gtest/gtest.h"
+
+TEST(NansTimelineSystemCoreClockSourceTest, ShouldOnlyMoveATestClockWhenItIsTold)
+{
+	FNTestClockSource Clock;
+	EXPECT_EQ(Clock.GetSeconds(), 0.);
+	Clock.Advance(1.5);
+	EXPECT_EQ(Clock.GetSeconds(), 1.5);
+	Clock.SetSeconds(10.);
+	EXPECT_EQ(Clock.GetSeconds(), 10.);
+}
+
+TEST(NansTimelineSystemCoreClockSourceTest, ShouldNeverGoBackwardWithAMonotonicClock)
+{
+	FNMonotonicClockSource Clock;
+	double Previous = Clock.GetSeconds();
+	for (int32 Idx = 0; Idx < 1000; Idx++)
+	{
+		const double Now = Clock.GetSeconds();
+		EXPECT_GE(Now, Previous);
+		Previous = Now;
+	}
+	EXPECT_GT(FNWallClockSource().GetSeconds(), 0.);
+}
+
+TEST(NansTimelineSystemCoreClockSourceTest, ShouldAccumulateTimeWithoutLosingAnyBetweenSamples)
+{
+	TSharedRef<FNTestClockSource> Clock = MakeShared<FNTestClockSource>();
+	Clock->SetSeconds(100.);
+	FNClockAccumulator Accumulator(Clock);
+	EXPECT_EQ(Accumulator.Sample(), 0.);
+
+	// Small frames are kept until they are consumed
+	double Consumed = 0.;
+	for (int32 Frame = 0; Frame < 10000; Frame++)
+	{
+		Clock->Advance(1. / 60.);
+		if (Accumulator.Sample() >= 1.)
+		{
+			Consumed += Accumulator.Consume();
+		}
+	}
+	Consumed += Accumulator.Consume();
+	EXPECT_NEAR(Consumed, 10000. / 60., 1e-9);
+
+	// A clock going backward adds nothing, then it counts from its new time
+	Clock->Advance(-5.);
+	EXPECT_EQ(Accumulator.Sample(), 0.);
+	Clock->Advance(2.);
+	EXPECT_EQ(Accumulator.Sample(), 2.);
+	EXPECT_EQ(Accumulator.GetAccumulated(), 2.);
+
+	Clock->Advance(3.);
+	Accumulator.Reset();
+	EXPECT_EQ(Accumulator.Sample(), 0.);
+
+	TSharedRef<FNTestClockSource> OtherClock = MakeShared<FNTestClockSource>();
+	Accumulator.SetSource(OtherClock);
+	OtherClock->Advance(0.25);
+	EXPECT_EQ(Accumulator.Sample(), 0.25);
+}
@@ -0,0 +1,163 @@
+#include "CoreMinimal.h"
+#include "GoogleTestApp.h"
+#include "NansTimelineSystemCore/Public/EventStore.h"
+#include "Math/RandomStream.h"
+#include "gtest/gtest.h"
+
+#include <iostream>
+
+class NansTimelineSystemCoreEventStoreTest : public ::testing::Test
+{
+protected:
+	/** One set of kernel inputs/outputs */
+	struct FKernelData
+	{
+		TArray<float> LocalTimes;
+		TArray<float> PreviousLocalTimes;
+		TArray<float> Steps;
+		TArray<float> Durations;
+		TArray<uint32> ExpiredBits;
+	};
+
+	FKernelData MakeData(const int32& Num, const int32& Seed) const
+	{
+		FRandomStream Random(Seed);
+		FKernelData Data;
+		Data.LocalTimes.AddUninitialized(Num);
+		Data.PreviousLocalTimes.AddZeroed(Num);
+		Data.Steps.AddUninitialized(Num);
+		Data.Durations.AddUninitialized(Num);
+		for (int32 Idx = 0; Idx < Num; Idx++)
+		{
+			Data.LocalTimes[Idx] = Random.FRandRange(0.f, 10.f);
+			Data.Steps[Idx] = Random.FRand() < 0.8f ? 1.f : 0.f;
+			// Infinite, negative, reached exactly with a 0.5 delta & random durations
+			const int32 Kind = Random.RandHelper(4);
+			if (Kind == 0)
+			{
+				Data.Durations[Idx] = 0.f;
+			}
+			else if (Kind == 1)
+			{
+				Data.Durations[Idx] = -1.f;
+			}
+			else if (Kind == 2)
+			{
+				Data.Durations[Idx] = Data.LocalTimes[Idx] + 0.5f;
+			}
+			else
+			{
+				Data.Durations[Idx] = Random.FRandRange(0.f, 12.f);
+			}
+		}
+		return Data;
+	}
+
+	void Advance(FKernelData& Data, const float& Delta, const bool& bVector) const
+	{
+		Data.ExpiredBits.Reset();
+		Data.ExpiredBits.AddZeroed((Data.LocalTimes.Num() + 31) / 32);
+		if (bVector)
+		{
+			FNEventStore::AdvanceVector(
+				Data.LocalTimes.GetData(), Data.PreviousLocalTimes.GetData(), Data.Steps.GetData(),
+				Data.Durations.GetData(), Data.LocalTimes.Num(), Delta, Data.ExpiredBits.GetData()
+			);
+			return;
+		}
+		FNEventStore::AdvanceScalar(
+			Data.LocalTimes.GetData(), Data.PreviousLocalTimes.GetData(), Data.Steps.GetData(),
+			Data.Durations.GetData(), Data.LocalTimes.Num(), Delta, Data.ExpiredBits.GetData()
+		);
+	}
+
+	void ExpectSameBits(const FKernelData& Scalar, const FKernelData& Vector) const
+	{
+		ASSERT_EQ(Scalar.LocalTimes.Num(), Vector.LocalTimes.Num());
+		const int32 Num = Scalar.LocalTimes.Num();
+		EXPECT_EQ(FMemory::Memcmp(Scalar.LocalTimes.GetData(), Vector.LocalTimes.GetData(), Num * sizeof(float)), 0);
+		EXPECT_EQ(
+			FMemory::Memcmp(Scalar.PreviousLocalTimes.GetData(), Vector.PreviousLocalTimes.GetData(), Num * sizeof(float)),
+			0
+		);
+		EXPECT_EQ(Scalar.ExpiredBits, Vector.ExpiredBits);
+	}
+};
+
+TEST_F(NansTimelineSystemCoreEventStoreTest, VectorKernelShouldGiveTheSameBitsThanScalarKernel)
+{
+	// Sizes around the vector width and the bits words
+	for (const int32 Num : {0, 1, 3, 4, 5, 31, 32, 33, 63, 64, 65, 1000, 1027})
+	{
+		FKernelData Scalar = MakeData(Num, Num + 1);
+		FKernelData Vector = MakeData(Num, Num + 1);
+		for (const float Delta : {1.f, 0.5f, 0.1f, 1.f / 60.f, 0.f})
+		{
+			Advance(Scalar, Delta, false);
+			Advance(Vector, Delta, true);
+			ExpectSameBits(Scalar, Vector);
+		}
+	}
+}
+
+TEST_F(NansTimelineSystemCoreEventStoreTest, KernelsShouldOnlyAdvanceTickedEventsAndFlagExpiredOnes)
+{
+	FKernelData Data;
+	Data.LocalTimes = {0.f, 1.f, 1.f, 3.f, 0.f};
+	Data.PreviousLocalTimes.AddZeroed(5);
+	Data.Steps = {1.f, 1.f, 0.f, 1.f, 1.f};
+	Data.Durations = {0.f, 2.f, 2.f, 2.f, -1.f};
+
+	for (const bool bVector : {false, true})
+	{
+		FKernelData Result = Data;
+		Advance(Result, 1.f, bVector);
+		EXPECT_EQ(Result.LocalTimes, TArray<float>({1.f, 2.f, 1.f, 4.f, 1.f}));
+		EXPECT_EQ(Result.PreviousLocalTimes, Data.LocalTimes);
+		// Only 1 reaches its duration and 3 is already over it, 2 is not ticked.
+		ASSERT_EQ(Result.ExpiredBits.Num(), 1);
+		EXPECT_EQ(Result.ExpiredBits[0], (1u << 1) | (1u << 3));
+	}
+}
+
+TEST_F(NansTimelineSystemCoreEventStoreTest, ShouldReuseFreedIndexes)
+{
+	FNEventStore Store;
+	const int32 First = Store.Allocate(FName("first"), FGuid());
+	const int32 Second = Store.Allocate(FName("second"), FGuid());
+	EXPECT_EQ(Store.Num(), 2);
+	Store.Free(First);
+	EXPECT_FALSE(Store.IsValidIndex(First));
+	EXPECT_TRUE(Store.IsValidIndex(Second));
+	EXPECT_EQ(Store.Allocate(FName("third"), FGuid()), First);
+	EXPECT_EQ(Store.Num(), 2);
+}
+
+TEST_F(NansTimelineSystemCoreEventStoreTest, DISABLED_BenchmarkKernels)
+{
+	constexpr int32 NumIterations = 100;
+	std::cout << "[ BENCH    ] vector kernel supported: " << FNEventStore::IsVectorKernelSupported() << std::endl;
+	for (const int32 Num : {1000, 10000, 100000})
+	{
+		FKernelData Scalar = MakeData(Num, 42);
+		FKernelData Vector = MakeData(Num, 42);
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Idx = 0; Idx < NumIterations; Idx++)
+		{
+			Advance(Scalar, 1.f / 60.f, false);
+		}
+		const double ScalarTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Idx = 0; Idx < NumIterations; Idx++)
+		{
+			Advance(Vector, 1.f / 60.f, true);
+		}
+		const double VectorTime = FPlatformTime::Seconds() - StartTime;
+
+		ExpectSameBits(Scalar, Vector);
+		std::cout << "[ BENCH    ] " << Num << " events: scalar " << ScalarTime * 1000.0 / NumIterations
+			<< "ms, vector " << VectorTime * 1000.0 / NumIterations << "ms per tick" << std::endl;
+	}
+}
@@ -1,8 +1,12 @@
 #include "CoreMinimal.h"
+#include "Async/Async.h"
 #include "GoogleTestApp.h"
 #include "NansTimelineSystemCore/Public/Event.h"
 #include "NansTimelineSystemCore/Public/Timeline.h"
 #include "NansTimelineSystemCore/Public/TimelineManager.h"
+#include "NansTimelineSystemCore/Public/TimelineArchive.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 #include "gtest/gtest.h"
 
 #include <iostream>
@@ -262,3 +266,1278 @@ TEST_F(NansTimelineSystemCoreTimelineTest, ShouldTriggerAnEventWhenEventStart)
 	EXPECT_TRUE(Events[2]->IsExpired());
 	EXPECT_TRUE(Test);
 }
+
+/** Overrides AddTime() as a user subclass would, it must never be bound to the clock */
+class FNUnboundEventFake : public FNEventFake
+{
+public:
+	int32 AddTimeCalls = 0;
+
+	FNUnboundEventFake(FName InLabel, float InDuration = 0.f, float InDelay = 0.f)
+		: FNEventFake(InLabel, InDuration, InDelay) {}
+
+	virtual void AddTime(const float& NewTime) override
+	{
+		++AddTimeCalls;
+		FNEventFake::AddTime(NewTime);
+	}
+};
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldCallAddTimeOnSubclassesOverridingIt)
+{
+	const float TickInterval = Timer->GetTimeline()->GetTickInterval();
+	TSharedPtr<FNUnboundEventFake> Event = MakeShareable(new FNUnboundEventFake(FName("overriding"), 10.f));
+	Timer->GetTimeline()->Attached(Event);
+	Timer->Play();
+	Timer->TimerTick(TickInterval);
+	Timer->TimerTick(TickInterval);
+	Timer->TimerTick(TickInterval);
+	EXPECT_FALSE(Event->BindClock(MakeShared<FNTimelineClock>()));
+	EXPECT_EQ(Event->AddTimeCalls, 3);
+	EXPECT_EQ(Event->GetLocalTime(), 3 * TickInterval);
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldKeepLocalTimePreciseOnLongTimelines)
+{
+	const float DeltaTime = 0.1f;
+	// At this time, a float timeline time only moves by steps of 0.0625 secs
+	Timer->GetTimeline()->SetCurrentTime(1000000.f);
+	TSharedPtr<INEvent> Event = Timer->CreateNewEvent(FName("late"));
+	Timer->GetTimeline()->Attached(Event);
+	Timer->Play();
+	for (int32 Idx = 0; Idx < 10; ++Idx)
+	{
+		Timer->TimerTick(DeltaTime);
+	}
+	EXPECT_NEAR(Event->GetLocalTime(), 10 * DeltaTime, 0.0001f);
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldKeepTheClockPreciseThroughSaves)
+{
+	const float DeltaTime = 0.1f;
+	Timer->GetTimeline()->SetCurrentTime(1000000.f);
+	Timer->Play();
+	Timer->TimerTick(DeltaTime);
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	Timer->Archive(Writer);
+	FNTimelineManager* LoadedTimer = new FNTimelineManager();
+	FMemoryReader Reader(Data);
+	LoadedTimer->Archive(Reader);
+	LoadedTimer->Play();
+
+	// A clock loaded from its float time would be ahead, and round to other values.
+	for (int32 Idx = 0; Idx < 10; ++Idx)
+	{
+		Timer->TimerTick(DeltaTime);
+		LoadedTimer->TimerTick(DeltaTime);
+		EXPECT_EQ(LoadedTimer->GetTimeline()->GetCurrentTime(), Timer->GetTimeline()->GetCurrentTime());
+	}
+	delete LoadedTimer;
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldNotifyDelayedEventsInTheirAttachmentOrder)
+{
+	TArray<TPair<FName, ENTimelineEvent>> Notifications;
+	Timer->OnEventChanged().AddLambda(
+		[&Notifications](TSharedPtr<INEvent> Event, const ENTimelineEvent& EventName, const float& EventTime,
+		const int32& Index)
+		{
+			if (EventName == ENTimelineEvent::Start || EventName == ENTimelineEvent::Tick)
+			{
+				Notifications.Add(TPair<FName, ENTimelineEvent>(Event->GetEventLabel(), EventName));
+			}
+		}
+	);
+
+	TSharedPtr<FNEventFake> Delayed = MakeShareable(new FNEventFake(FName("delayed"), 0.f, 2.f));
+	Timer->Play();
+	Timer->GetTimeline()->Attached({Events[0], Delayed, Events[3]});
+	Timer->TimerTick(Timer->GetTimeline()->GetTickInterval()); // 1 sec
+	Notifications.Empty();
+	Timer->TimerTick(Timer->GetTimeline()->GetTickInterval()); // 2 secs, "delayed" starts
+
+	ASSERT_EQ(Notifications.Num(), 3);
+	EXPECT_EQ(Notifications[0].Key, FName("event 0"));
+	EXPECT_EQ(Notifications[0].Value, ENTimelineEvent::Tick);
+	EXPECT_EQ(Notifications[1].Key, FName("delayed"));
+	EXPECT_EQ(Notifications[1].Value, ENTimelineEvent::Start);
+	EXPECT_EQ(Notifications[2].Key, FName("event 3"));
+	EXPECT_EQ(Notifications[2].Value, ENTimelineEvent::Tick);
+
+	EXPECT_EQ(Delayed->GetStartedAt(), 2.f);
+	EXPECT_EQ(Delayed->GetLocalTime(), 0.f);
+	Timer->TimerTick(Timer->GetTimeline()->GetTickInterval()); // 3 secs
+	EXPECT_EQ(Delayed->GetLocalTime(), 1.f);
+	EXPECT_EQ(Events[0]->GetLocalTime(), 3.f);
+
+	// LocalTime should be frozen when the timeline is cleared
+	Timer->Stop();
+	EXPECT_EQ(Events[0]->GetLocalTime(), 3.f);
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldExpireThousandsOfEventsInTheSameTick)
+{
+	constexpr int32 NumEvents = 5000;
+	int32 NumExpired = 0;
+	int32 NumWrongIndex = 0;
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	Timer->OnEventChanged().AddLambda(
+		[&NumExpired, &NumWrongIndex, &Timeline](TSharedPtr<INEvent> Event, const ENTimelineEvent& EventName,
+		const float& EventTime, const int32& Index)
+		{
+			if (EventName == ENTimelineEvent::Expired)
+			{
+				NumExpired++;
+			}
+			// The index should always retrieve the notified event while it is alive
+			if (EventName != ENTimelineEvent::BeforeAttached && Timeline->GetEventAt(Index) != Event)
+			{
+				NumWrongIndex++;
+			}
+		}
+	);
+
+	Timer->Play();
+	Timeline->Attached(Events[0]);
+	for (int32 Idx = 0; Idx < NumEvents; Idx++)
+	{
+		Timeline->Attached(MakeShareable(new FNEventFake(FName("short event"), 1.f)));
+	}
+	EXPECT_EQ(Timeline->GetEvents().Num(), NumEvents + 1);
+
+	Timer->TimerTick(Timeline->GetTickInterval());
+	EXPECT_EQ(NumExpired, NumEvents);
+	EXPECT_EQ(NumWrongIndex, 0);
+	ASSERT_EQ(Timeline->GetEvents().Num(), 1);
+	EXPECT_EQ(Timeline->GetEvents()[0], Events[0]);
+	EXPECT_EQ(Timeline->GetExpiredEvents().Num(), NumEvents);
+	EXPECT_TRUE(Timeline->GetEvent(Events[0]->GetUID()).IsValid());
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldReuseSlotsOfExpiredEventsAndKeepAttachmentOrder)
+{
+	constexpr int32 NumEvents = 2000;
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	Timer->Play();
+	for (int32 Idx = 0; Idx < NumEvents; Idx++)
+	{
+		// Every other event expires at the first tick
+		Timeline->Attached(MakeShareable(new FNEventFake(FName("event"), Idx % 2 == 0 ? 1.f : 0.f)));
+	}
+	const TArray<TSharedPtr<INEvent>> Survivors = Timeline->GetEvents().FilterByPredicate(
+		[](const TSharedPtr<INEvent>& Event)
+		{
+			return Event->GetDuration() <= 0.f;
+		}
+	);
+
+	Timer->TimerTick(Timeline->GetTickInterval());
+	EXPECT_EQ(Timeline->GetExpiredEvents().Num(), NumEvents / 2);
+
+	int32 NewIndex = -1;
+	Timer->OnEventChanged().AddLambda(
+		[&NewIndex](TSharedPtr<INEvent> Event, const ENTimelineEvent& EventName, const float& EventTime,
+		const int32& Index)
+		{
+			if (EventName == ENTimelineEvent::AfterAttached)
+			{
+				NewIndex = Index;
+			}
+		}
+	);
+	Timeline->Attached(Events[0]);
+	EXPECT_LT(NewIndex, NumEvents);
+	EXPECT_EQ(Timeline->GetEventAt(NewIndex), Events[0]);
+
+	// The newest event is still the last one even if it took a freed slot.
+	const TArray<TSharedPtr<INEvent>> LiveEvents = Timeline->GetEvents();
+	ASSERT_EQ(LiveEvents.Num(), Survivors.Num() + 1);
+	for (int32 Idx = 0; Idx < Survivors.Num(); Idx++)
+	{
+		EXPECT_EQ(LiveEvents[Idx], Survivors[Idx]);
+	}
+	EXPECT_EQ(LiveEvents.Last(), Events[0]);
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldRetrieveLoadedEventsByUID)
+{
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	Timer->Play();
+	for (int32 Idx = 0; Idx < 10; Idx++)
+	{
+		Timeline->Attached(Timer->CreateNewEvent(NAME_None, Idx % 2 == 0 ? 1.f : 0.f));
+	}
+	Timer->TimerTick(Timeline->GetTickInterval());
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	Timer->Archive(Writer);
+	FNTimelineManager* LoadedTimer = new FNTimelineManager();
+	TSharedPtr<FNTimeline> LoadedTimeline = LoadedTimer->GetTimeline();
+	FMemoryReader Reader(Data);
+	LoadedTimer->Archive(Reader);
+
+	for (const TSharedPtr<INEvent>& Event : Timeline->GetEvents())
+	{
+		const TSharedPtr<INEvent> Loaded = LoadedTimeline->GetEvent(Event->GetUID());
+		ASSERT_TRUE(Loaded.IsValid());
+		EXPECT_EQ(Loaded->GetUID(), Event->GetUID());
+	}
+	for (const TSharedPtr<INEvent>& Event : Timeline->GetExpiredEvents())
+	{
+		const TSharedPtr<INEvent> Loaded = LoadedTimeline->GetExpiredEvent(Event->GetUID());
+		ASSERT_TRUE(Loaded.IsValid());
+		EXPECT_EQ(Loaded->GetUID(), Event->GetUID());
+	}
+	EXPECT_EQ(LoadedTimeline->GetEvents().Num(), 5);
+	EXPECT_EQ(LoadedTimeline->GetExpiredEvents().Num(), 5);
+	delete LoadedTimer;
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, DISABLED_BenchmarkLoadAndRetrieve50kEventsByUID)
+{
+	constexpr int32 NumEvents = 50000;
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	Timer->Play();
+	for (int32 Idx = 0; Idx < NumEvents; Idx++)
+	{
+		Timeline->Attached(Timer->CreateNewEvent(NAME_None, Idx % 2 == 0 ? 1.f : 0.f));
+	}
+	Timer->TimerTick(Timeline->GetTickInterval());
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	Timer->Archive(Writer);
+
+	FNTimelineManager* LoadedTimer = new FNTimelineManager();
+	TSharedPtr<FNTimeline> LoadedTimeline = LoadedTimer->GetTimeline();
+	const double StartTime = FPlatformTime::Seconds();
+	FMemoryReader Reader(Data);
+	LoadedTimer->Archive(Reader);
+	const double ArchiveTime = FPlatformTime::Seconds();
+
+	// This is what UNTimelineManagerDecorator::Serialize() does for each event on load.
+	int32 NumFound = 0;
+	for (const TSharedPtr<INEvent>& Event : Timeline->GetEvents())
+	{
+		NumFound += LoadedTimeline->GetEvent(Event->GetUID()).IsValid() ? 1 : 0;
+	}
+	for (const TSharedPtr<INEvent>& Event : Timeline->GetExpiredEvents())
+	{
+		NumFound += LoadedTimeline->GetExpiredEvent(Event->GetUID()).IsValid() ? 1 : 0;
+	}
+	const double EndTime = FPlatformTime::Seconds();
+
+	EXPECT_EQ(NumFound, NumEvents);
+	std::cout << "[ BENCH    ] " << NumEvents << " events: archive " << (ArchiveTime - StartTime) * 1000.f
+		<< "ms, lookups " << (EndTime - ArchiveTime) * 1000.f << "ms" << std::endl;
+	delete LoadedTimer;
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldTickPackedEventsLikeEventObjects)
+{
+	FNTimelineManager* PackedTimer = new FNTimelineManager();
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	TSharedPtr<FNTimeline> PackedTimeline = PackedTimer->GetTimeline();
+	ASSERT_TRUE(PackedTimeline->SetStorage(ENTimelineStorage::Packed));
+
+	// Same durations & delays than Events
+	const TArray<TPair<float, float>> Timings = {{0.f, 0.f}, {2.f, 0.f}, {1.f, 2.f}, {4.f, 0.f}, {1.f, 0.f}};
+	TArray<TSharedPtr<INEvent>> ObjectEvents;
+	TArray<TSharedPtr<INEvent>> PackedEvents;
+	for (const TPair<float, float>& Timing : Timings)
+	{
+		ObjectEvents.Add(Timer->CreateNewEvent(FName("event"), Timing.Key, Timing.Value));
+		PackedEvents.Add(PackedTimer->CreateNewEvent(FName("event"), Timing.Key, Timing.Value));
+		int32 StoreIndex;
+		EXPECT_EQ(ObjectEvents.Last()->GetStore(StoreIndex), nullptr);
+		EXPECT_NE(PackedEvents.Last()->GetStore(StoreIndex), nullptr);
+	}
+
+	// An event which is not created by the timeline still works with packed ones.
+	TSharedPtr<FNEventFake> ObjectFake = MakeShareable(new FNEventFake(FName("fake"), 3.f));
+	TSharedPtr<FNEventFake> PackedFake = MakeShareable(new FNEventFake(FName("fake"), 3.f));
+
+	Timer->Play();
+	PackedTimer->Play();
+	for (int32 Tick = 0; Tick < 6; Tick++)
+	{
+		if (Tick < Timings.Num())
+		{
+			Timeline->Attached(ObjectEvents[Tick]);
+			PackedTimeline->Attached(PackedEvents[Tick]);
+		}
+		if (Tick == 1)
+		{
+			Timeline->Attached(ObjectFake);
+			PackedTimeline->Attached(PackedFake);
+		}
+		if (Tick == 2)
+		{
+			ObjectEvents[0]->Stop();
+			PackedEvents[0]->Stop();
+		}
+		Timer->TimerTick(Timeline->GetTickInterval());
+		PackedTimer->TimerTick(PackedTimeline->GetTickInterval());
+
+		for (int32 Idx = 0; Idx < ObjectEvents.Num(); Idx++)
+		{
+			EXPECT_EQ(ObjectEvents[Idx]->GetLocalTime(), PackedEvents[Idx]->GetLocalTime());
+			EXPECT_EQ(ObjectEvents[Idx]->GetStartedAt(), PackedEvents[Idx]->GetStartedAt());
+			EXPECT_EQ(ObjectEvents[Idx]->GetExpiredTime(), PackedEvents[Idx]->GetExpiredTime());
+			EXPECT_EQ(ObjectEvents[Idx]->IsExpired(), PackedEvents[Idx]->IsExpired());
+		}
+		EXPECT_EQ(ObjectFake->GetLocalTime(), PackedFake->GetLocalTime());
+		EXPECT_EQ(Timeline->GetEvents().Num(), PackedTimeline->GetEvents().Num());
+		EXPECT_EQ(Timeline->GetExpiredEvents().Num(), PackedTimeline->GetExpiredEvents().Num());
+	}
+
+	// A packed timeline loads packed events
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	PackedTimer->Archive(Writer);
+	FNTimelineManager* LoadedTimer = new FNTimelineManager();
+	ASSERT_TRUE(LoadedTimer->GetTimeline()->SetStorage(ENTimelineStorage::Packed));
+	FMemoryReader Reader(Data);
+	LoadedTimer->Archive(Reader);
+	const TSharedPtr<INEvent> Loaded = LoadedTimer->GetTimeline()->GetEvent(PackedEvents[3]->GetGUID());
+	ASSERT_TRUE(Loaded.IsValid());
+	int32 StoreIndex;
+	EXPECT_NE(Loaded->GetStore(StoreIndex), nullptr);
+	EXPECT_EQ(Loaded->GetLocalTime(), PackedEvents[3]->GetLocalTime());
+	EXPECT_FALSE(LoadedTimer->GetTimeline()->SetStorage(ENTimelineStorage::Objects));
+
+	delete LoadedTimer;
+	delete PackedTimer;
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldReleaseTheStoreIndexOfExpiredPackedEvents)
+{
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	ASSERT_TRUE(Timeline->SetStorage(ENTimelineStorage::Packed));
+	const TSharedPtr<INEvent> Short = Timer->CreateNewEvent(FName("short"), 1.f);
+	const TSharedPtr<INEvent> Long = Timer->CreateNewEvent(FName("long"), 3.f);
+	int32 ShortIndex;
+	ASSERT_NE(Short->GetStore(ShortIndex), nullptr);
+
+	Timer->Play();
+	Timeline->Attached(Short);
+	Timeline->Attached(Long);
+	Timer->TimerTick(Timeline->GetTickInterval());
+
+	// The expired event keeps its values, but not its index in the store.
+	ASSERT_EQ(Timeline->GetExpiredEvent(Short->GetGUID()), Short);
+	int32 StoreIndex;
+	EXPECT_EQ(Short->GetStore(StoreIndex), nullptr);
+	EXPECT_TRUE(Short->IsExpired());
+	EXPECT_EQ(Short->GetEventLabel(), FName("short"));
+	EXPECT_EQ(Short->GetLocalTime(), 1.f);
+	EXPECT_EQ(Short->GetDuration(), 1.f);
+	EXPECT_EQ(Short->GetExpiredTime(), 1.f);
+
+	// Its index is reused by the next event, the store doesn't grow with the history.
+	const TSharedPtr<INEvent> Next = Timer->CreateNewEvent(FName("next"), 1.f);
+	EXPECT_NE(Next->GetStore(StoreIndex), nullptr);
+	EXPECT_EQ(StoreIndex, ShortIndex);
+	EXPECT_EQ(Short->GetEventLabel(), FName("short"));
+	EXPECT_EQ(Long->GetLocalTime(), 1.f);
+
+	// Expired events are still saved and loaded.
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	Timer->Archive(Writer);
+	FNTimelineManager* LoadedTimer = new FNTimelineManager();
+	ASSERT_TRUE(LoadedTimer->GetTimeline()->SetStorage(ENTimelineStorage::Packed));
+	FMemoryReader Reader(Data);
+	LoadedTimer->Archive(Reader);
+	const TSharedPtr<INEvent> Loaded = LoadedTimer->GetTimeline()->GetExpiredEvent(Short->GetGUID());
+	ASSERT_TRUE(Loaded.IsValid());
+	EXPECT_EQ(Loaded->GetStore(StoreIndex), nullptr);
+	EXPECT_EQ(Loaded->GetEventLabel(), FName("short"));
+	EXPECT_EQ(Loaded->GetLocalTime(), 1.f);
+	delete LoadedTimer;
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldBatchNotificationsByTypeOncePerTick)
+{
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	TArray<FNTimelineNotification> SingleTicks;
+	Timer->OnEventChanged().AddLambda(
+		[&SingleTicks](TSharedPtr<INEvent> Event, const ENTimelineEvent& EventName, const float& EventTime,
+		const int32& Index)
+		{
+			if (EventName == ENTimelineEvent::Tick)
+			{
+				SingleTicks.Emplace(Event, EventName, EventTime, Index);
+			}
+		}
+	);
+
+	int32 NumTickBatches = 0;
+	TArray<FNTimelineNotification> BatchedTicks;
+	Timer->OnEventsChanged(ENTimelineEvent::Tick).AddLambda(
+		[&NumTickBatches, &BatchedTicks](TArrayView<const FNTimelineNotification> Notifications)
+		{
+			NumTickBatches++;
+			BatchedTicks.Append(Notifications.GetData(), Notifications.Num());
+		}
+	);
+
+	TArray<TSharedPtr<INEvent>> Expired;
+	Timer->OnEventsChanged(ENTimelineEvent::Expired).AddLambda(
+		[&Expired](TArrayView<const FNTimelineNotification> Notifications)
+		{
+			for (const FNTimelineNotification& Notification : Notifications)
+			{
+				EXPECT_EQ(Notification.EventName, ENTimelineEvent::Expired);
+				Expired.Add(Notification.Event);
+			}
+		}
+	);
+
+	// Attachments are flushed right away when the timeline is not ticking
+	int32 NumAttached = 0;
+	Timer->OnEventsChanged(ENTimelineEvent::AfterAttached).AddLambda(
+		[&NumAttached](TArrayView<const FNTimelineNotification> Notifications)
+		{
+			NumAttached += Notifications.Num();
+		}
+	);
+	Timeline->Attached({Events[0], Events[1], Events[3], Events[4]});
+	EXPECT_EQ(NumAttached, 4);
+
+	Timer->Play();
+	Timer->TimerTick(Timeline->GetTickInterval()); // 1 sec
+	EXPECT_EQ(NumTickBatches, 1);
+	EXPECT_EQ(BatchedTicks.Num(), 4);
+	ASSERT_EQ(Expired.Num(), 1);
+	EXPECT_EQ(Expired[0], Events[4]);
+
+	Timer->TimerTick(Timeline->GetTickInterval()); // 2 secs
+	EXPECT_EQ(NumTickBatches, 2);
+	ASSERT_EQ(Expired.Num(), 2);
+	EXPECT_EQ(Expired[1], Events[1]);
+
+	// Batches hold exactly what the per event delegate received, in the same order
+	ASSERT_EQ(BatchedTicks.Num(), SingleTicks.Num());
+	for (int32 Idx = 0; Idx < BatchedTicks.Num(); Idx++)
+	{
+		EXPECT_EQ(BatchedTicks[Idx].Event, SingleTicks[Idx].Event);
+		EXPECT_EQ(BatchedTicks[Idx].Time, SingleTicks[Idx].Time);
+		EXPECT_EQ(BatchedTicks[Idx].Index, SingleTicks[Idx].Index);
+	}
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldSkipTickNotificationsOfEventsWhichOptOut)
+{
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	TMap<TSharedPtr<INEvent>, int32> NumTicks;
+	int32 NumExpired = 0;
+	Timer->OnEventChanged().AddLambda(
+		[&NumTicks, &NumExpired](TSharedPtr<INEvent> Event, const ENTimelineEvent& EventName, const float& EventTime,
+		const int32& Index)
+		{
+			if (EventName == ENTimelineEvent::Tick)
+			{
+				NumTicks.FindOrAdd(Event)++;
+			}
+			if (EventName == ENTimelineEvent::Expired)
+			{
+				NumExpired++;
+			}
+		}
+	);
+
+	Timeline->Attached({Events[0], Events[1]});
+	EXPECT_TRUE(Timeline->SetTickNotified(Events[1]->GetGUID(), false));
+	EXPECT_FALSE(Timeline->SetTickNotified(Events[2]->GetGUID(), false));
+
+	Timer->Play();
+	Timer->TimerTick(Timeline->GetTickInterval());
+	Timer->TimerTick(Timeline->GetTickInterval());
+
+	EXPECT_EQ(NumTicks.FindRef(Events[0]), 2);
+	EXPECT_EQ(NumTicks.FindRef(Events[1]), 0);
+	// Other notifications & time computation are not affected
+	EXPECT_EQ(NumExpired, 1);
+	EXPECT_EQ(Events[1]->GetLocalTime(), 2.f);
+	EXPECT_TRUE(Events[1]->IsExpired());
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldReuseExpiredEventsWhenPoolingIsEnabled)
+{
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	Timeline->SetPoolCapacity(2);
+	Timer->Play();
+
+	// This one is still referenced here, so it can't be pooled
+	TSharedPtr<INEvent> Kept = Timer->CreateNewEvent(FName("kept"), 1.f);
+	Timeline->Attached(Kept);
+	for (int32 Idx = 0; Idx < 3; Idx++)
+	{
+		Timeline->Attached(Timer->CreateNewEvent(FName("short"), 1.f));
+	}
+	// Events which are not created by the timeline are never pooled
+	Timeline->Attached(Events[4]);
+	int32 NumEvicted = 0;
+	Timer->OnExpiredEventEvicted().AddLambda(
+		[&NumEvicted](const FGuid& UID)
+		{
+			NumEvicted++;
+		}
+	);
+	Timer->TimerTick(Timeline->GetTickInterval());
+
+	// Pooled events never enter the history, listeners are told as for evicted ones.
+	EXPECT_EQ(NumEvicted, 2);
+	FNEventPoolStats Stats = Timeline->GetPoolStats();
+	EXPECT_EQ(Stats.Misses, 4);
+	EXPECT_EQ(Stats.Recycled, 2);
+	EXPECT_EQ(Stats.Pooled, 2);
+	// The third one exceeds the capacity
+	EXPECT_EQ(Timeline->GetExpiredEvents().Num(), 3);
+	EXPECT_TRUE(Timeline->GetExpiredEvent(Kept->GetGUID()).IsValid());
+	EXPECT_TRUE(Timeline->GetExpiredEvent(Events[4]->GetGUID()).IsValid());
+
+	const TSharedPtr<INEvent> Reused = Timer->CreateNewEvent(FName("reused"), 2.f, 1.f);
+	Stats = Timeline->GetPoolStats();
+	EXPECT_EQ(Stats.Hits, 1);
+	EXPECT_EQ(Stats.Pooled, 1);
+	// Reset as a brand new event
+	EXPECT_EQ(Reused->GetEventLabel(), FName("reused"));
+	EXPECT_EQ(Reused->GetDuration(), 2.f);
+	EXPECT_EQ(Reused->GetDelay(), 1.f);
+	EXPECT_EQ(Reused->GetLocalTime(), 0.f);
+	EXPECT_EQ(Reused->GetStartedAt(), -1.f);
+	EXPECT_EQ(Reused->GetExpiredTime(), -1.f);
+	EXPECT_FALSE(Reused->IsExpired());
+	EXPECT_FALSE(Timeline->GetEvent(Reused->GetGUID()).IsValid());
+	EXPECT_FALSE(Timeline->GetExpiredEvent(Reused->GetGUID()).IsValid());
+
+	Timeline->Attached(Reused);
+	Timer->TimerTick(Timeline->GetTickInterval());
+	EXPECT_EQ(Reused->GetStartedAt(), 2.f);
+	EXPECT_EQ(Reused->GetLocalTime(), 0.f);
+	Timer->TimerTick(Timeline->GetTickInterval());
+	EXPECT_EQ(Reused->GetLocalTime(), 1.f);
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldBoundExpiredEventsWithItsPolicy)
+{
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	FNExpiredEventsPolicy Policy;
+	Policy.Retention = ENExpiredEventsRetention::Last;
+	Policy.MaxEvents = 2;
+	Policy.bSummarize = true;
+	Timeline->SetExpiredEventsPolicy(Policy);
+	TArray<FGuid> Evicted;
+	Timer->OnExpiredEventEvicted().AddLambda(
+		[&Evicted](const FGuid& UID)
+		{
+			Evicted.Add(UID);
+		}
+	);
+	Timer->Play();
+
+	TArray<TSharedPtr<INEvent>> Shorts;
+	for (int32 Idx = 0; Idx < 4; Idx++)
+	{
+		Shorts.Add(Timer->CreateNewEvent(FName("short"), 1.f));
+		Timeline->Attached(Shorts.Last());
+	}
+	Timer->TimerTick(Timeline->GetTickInterval());
+
+	// The oldest ones are evicted
+	ASSERT_EQ(Timeline->GetExpiredEvents().Num(), 2);
+	EXPECT_EQ(Timeline->GetExpiredEvents()[0], Shorts[2]);
+	EXPECT_EQ(Timeline->GetExpiredEvents()[1], Shorts[3]);
+	EXPECT_FALSE(Timeline->GetExpiredEvent(Shorts[0]->GetGUID()).IsValid());
+	EXPECT_EQ(Timeline->GetExpiredEvent(Shorts[3]->GetGUID()), Shorts[3]);
+	ASSERT_EQ(Evicted.Num(), 2);
+	EXPECT_EQ(Evicted[0], Shorts[0]->GetGUID());
+	EXPECT_EQ(Evicted[1], Shorts[1]->GetGUID());
+
+	FNExpiredEventsSummary Summary = Timeline->GetExpiredEventsSummary();
+	EXPECT_EQ(Summary.Num, 2);
+	EXPECT_EQ(Summary.FirstExpiredTime, 1.f);
+	EXPECT_EQ(Summary.LastExpiredTime, 1.f);
+	EXPECT_EQ(Summary.TotalLocalTime, 2.f);
+
+	// Indexes stay valid after the ring buffer wraps
+	const TSharedPtr<INEvent> Last = Timer->CreateNewEvent(FName("last"), 1.f);
+	Timeline->Attached(Last);
+	Timer->TimerTick(Timeline->GetTickInterval());
+	EXPECT_EQ(Timeline->GetExpiredEvent(Last->GetGUID()), Last);
+	EXPECT_EQ(Timeline->GetExpiredEvent(Shorts[3]->GetGUID()), Shorts[3]);
+	EXPECT_FALSE(Timeline->GetExpiredEvent(Shorts[2]->GetGUID()).IsValid());
+
+	Policy.Retention = ENExpiredEventsRetention::Lifespan;
+	Policy.Lifespan = 1.5f;
+	Timeline->SetExpiredEventsPolicy(Policy);
+	Timer->TimerTick(Timeline->GetTickInterval());
+	// Shorts[3] expired at 1, Last at 2
+	EXPECT_FALSE(Timeline->GetExpiredEvent(Shorts[3]->GetGUID()).IsValid());
+	EXPECT_EQ(Timeline->GetExpiredEvent(Last->GetGUID()), Last);
+
+	Policy.Retention = ENExpiredEventsRetention::None;
+	Timeline->SetExpiredEventsPolicy(Policy);
+	EXPECT_EQ(Timeline->GetExpiredEvents().Num(), 0);
+	EXPECT_EQ(Timeline->GetExpiredEventsSummary().Num, 5);
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldLoadLegacyAndCompactSaves)
+{
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	Timer->Play();
+	for (int32 Idx = 0; Idx < 20; Idx++)
+	{
+		Timeline->Attached(Timer->CreateNewEvent(FName(Idx % 2 == 0 ? "even" : "odd"), Idx % 3, Idx % 4 * 0.25f));
+	}
+	Timer->TimerTick(Timeline->GetTickInterval());
+	Timer->TimerTick(Timeline->GetTickInterval());
+
+	auto ExpectSameEvents = [](const TArray<TSharedPtr<INEvent>>& Expected, const TArray<TSharedPtr<INEvent>>& Loaded)
+	{
+		ASSERT_EQ(Expected.Num(), Loaded.Num());
+		for (int32 Idx = 0; Idx < Expected.Num(); Idx++)
+		{
+			EXPECT_EQ(Expected[Idx]->GetGUID(), Loaded[Idx]->GetGUID());
+			EXPECT_EQ(Expected[Idx]->GetEventLabel(), Loaded[Idx]->GetEventLabel());
+			EXPECT_FLOAT_EQ(Expected[Idx]->GetAttachedTime(), Loaded[Idx]->GetAttachedTime());
+			EXPECT_FLOAT_EQ(Expected[Idx]->GetDelay(), Loaded[Idx]->GetDelay());
+			EXPECT_FLOAT_EQ(Expected[Idx]->GetDuration(), Loaded[Idx]->GetDuration());
+			EXPECT_FLOAT_EQ(Expected[Idx]->GetLocalTime(), Loaded[Idx]->GetLocalTime());
+			EXPECT_FLOAT_EQ(Expected[Idx]->GetStartedAt(), Loaded[Idx]->GetStartedAt());
+			EXPECT_FLOAT_EQ(Expected[Idx]->GetExpiredTime(), Loaded[Idx]->GetExpiredTime());
+			EXPECT_EQ(Expected[Idx]->IsExpired(), Loaded[Idx]->IsExpired());
+		}
+	};
+
+	TArray<uint8> LegacyData;
+	FMemoryWriter LegacyWriter(LegacyData);
+	Timeline->Archive(LegacyWriter, ENTimelineArchiveVersion::Legacy);
+	TArray<uint8> CompactData;
+	FMemoryWriter CompactWriter(CompactData);
+	Timeline->Archive(CompactWriter);
+	EXPECT_EQ(CompactWriter.CustomVer(FNTimelineArchive::VersionGUID), static_cast<int32>(ENTimelineArchiveVersion::Latest));
+	EXPECT_LT(CompactData.Num(), LegacyData.Num());
+
+	for (TArray<uint8>* Data : {&LegacyData, &CompactData})
+	{
+		FNTimeline Loaded(NAME_None);
+		FMemoryReader Reader(*Data);
+		Loaded.Archive(Reader);
+		EXPECT_FALSE(Reader.IsError());
+		EXPECT_EQ(Loaded.GetLabel(), Timeline->GetLabel());
+		EXPECT_EQ(Loaded.GetCurrentTime(), Timeline->GetCurrentTime());
+		ExpectSameEvents(Timeline->GetEvents(), Loaded.GetEvents());
+		ExpectSameEvents(Timeline->GetExpiredEvents(), Loaded.GetExpiredEvents());
+		EXPECT_TRUE(Loaded.GetExpiredEvent(Timeline->GetExpiredEvents()[0]->GetGUID()).IsValid());
+	}
+
+	// Times are rounded to the millisecond, which is exact here
+	Timeline->SetArchivePackedTimes(true);
+	TArray<uint8> PackedData;
+	FMemoryWriter PackedWriter(PackedData);
+	Timeline->Archive(PackedWriter);
+	EXPECT_LT(PackedData.Num(), CompactData.Num());
+	FNTimeline Loaded(NAME_None);
+	FMemoryReader Reader(PackedData);
+	Loaded.Archive(Reader);
+	ExpectSameEvents(Timeline->GetEvents(), Loaded.GetEvents());
+	ExpectSameEvents(Timeline->GetExpiredEvents(), Loaded.GetExpiredEvents());
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldPackTimesOfTimelinesOlderThan25Days)
+{
+	// 2^31 ms is about 24.8 days, these times don't fit in an int32 of milliseconds
+	const float Times[] = {0.f, -1.f, 1.5f, 30.f * 24 * 3600, 400.f * 24 * 3600 + 0.5f};
+	TArray<FName> Names;
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	FNTimelineArchive SavingAr(Writer, Names, true);
+	for (float Time : Times)
+	{
+		SavingAr.SerializeTime(Time);
+		SavingAr.SerializeAttachedTime(Time);
+	}
+
+	FMemoryReader Reader(Data);
+	FNTimelineArchive LoadingAr(Reader, Names, true);
+	for (const float& Time : Times)
+	{
+		float Loaded = 0.f;
+		float LoadedAttached = 0.f;
+		LoadingAr.SerializeTime(Loaded);
+		LoadingAr.SerializeAttachedTime(LoadedAttached);
+		EXPECT_FLOAT_EQ(Loaded, Time);
+		EXPECT_FLOAT_EQ(LoadedAttached, Time);
+	}
+	EXPECT_FALSE(LoadingAr.IsError());
+	EXPECT_EQ(Reader.Tell(), Data.Num());
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, DISABLED_BenchmarkArchiveFormatsWith100kEvents)
+{
+	constexpr int32 NumEvents = 100000;
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	Timer->Play();
+	for (int32 Idx = 0; Idx < NumEvents; Idx++)
+	{
+		Timeline->Attached(Timer->CreateNewEvent(FName("event", Idx % 16), Idx % 2 == 0 ? 1.f : 0.f));
+	}
+	Timer->TimerTick(Timeline->GetTickInterval());
+
+	auto Measure = [&Timeline](const ENTimelineArchiveVersion& Version, const bool& bPackedTimes, const TCHAR* Name)
+	{
+		Timeline->SetArchivePackedTimes(bPackedTimes);
+		TArray<uint8> Data;
+		double StartTime = FPlatformTime::Seconds();
+		FMemoryWriter Writer(Data);
+		Timeline->Archive(Writer, Version);
+		const double SaveTime = FPlatformTime::Seconds() - StartTime;
+
+		FNTimeline Loaded(NAME_None);
+		StartTime = FPlatformTime::Seconds();
+		FMemoryReader Reader(Data);
+		Loaded.Archive(Reader);
+		const double LoadTime = FPlatformTime::Seconds() - StartTime;
+
+		EXPECT_EQ(Loaded.GetEvents().Num() + Loaded.GetExpiredEvents().Num(), NumEvents);
+		std::cout << "[ BENCH    ] " << NumEvents << " events, " << TCHAR_TO_ANSI(Name) << ": " << Data.Num() / 1024
+			<< "KB, save " << SaveTime * 1000.0 << "ms, load " << LoadTime * 1000.0 << "ms" << std::endl;
+		return Data.Num();
+	};
+
+	const int32 LegacySize = Measure(ENTimelineArchiveVersion::Legacy, false, TEXT("legacy"));
+	const int32 CompactSize = Measure(ENTimelineArchiveVersion::Compact, false, TEXT("compact"));
+	const int32 PackedSize = Measure(ENTimelineArchiveVersion::Compact, true, TEXT("compact + packed times"));
+	Measure(ENTimelineArchiveVersion::IndexedExpiredEvents, true, TEXT("lazy expired events"));
+	EXPECT_LT(CompactSize, LegacySize);
+	EXPECT_LT(PackedSize, CompactSize);
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldReadExpiredEventsOnlyWhenTheyAreAccessed)
+{
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	Timeline->SetArchivePackedTimes(true);
+	Timer->Play();
+	for (int32 Idx = 0; Idx < 10; Idx++)
+	{
+		Timeline->Attached(Timer->CreateNewEvent(FName("event", Idx % 3), 1.f + Idx % 2, Idx % 3));
+		Timer->TimerTick(Timeline->GetTickInterval());
+	}
+	Timer->TimerTick(Timeline->GetTickInterval());
+	const TArray<TSharedPtr<INEvent>> Expired = Timeline->GetExpiredEvents();
+	ASSERT_GT(Expired.Num(), 3);
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	Timeline->Archive(Writer);
+	FNTimeline Loaded(NAME_None);
+	FMemoryReader Reader(Data);
+	Loaded.Archive(Reader);
+	EXPECT_FALSE(Reader.IsError());
+
+	// Records are read in any order and the same event is returned for each access.
+	for (int32 Idx = Expired.Num() - 1; Idx >= 0; Idx--)
+	{
+		const TSharedPtr<INEvent> Event = Loaded.GetExpiredEvent(Expired[Idx]->GetGUID());
+		ASSERT_TRUE(Event.IsValid());
+		EXPECT_EQ(Event, Loaded.GetExpiredEvent(Expired[Idx]->GetGUID()));
+		EXPECT_EQ(Event->GetEventLabel(), Expired[Idx]->GetEventLabel());
+		EXPECT_FLOAT_EQ(Event->GetAttachedTime(), Expired[Idx]->GetAttachedTime());
+		EXPECT_FLOAT_EQ(Event->GetStartedAt(), Expired[Idx]->GetStartedAt());
+		EXPECT_FLOAT_EQ(Event->GetExpiredTime(), Expired[Idx]->GetExpiredTime());
+		EXPECT_TRUE(Event->IsExpired());
+	}
+	EXPECT_EQ(Loaded.GetExpiredEvents()[0], Loaded.GetExpiredEvent(Expired[0]->GetGUID()));
+
+	// The lifespan policy reads the expired time of records which have not been accessed yet.
+	FNTimeline Bounded(NAME_None);
+	FMemoryReader BoundedReader(Data);
+	Bounded.Archive(BoundedReader);
+	FNExpiredEventsPolicy Policy;
+	Policy.Retention = ENExpiredEventsRetention::Lifespan;
+	Policy.Lifespan = Timeline->GetCurrentTime() - Expired[1]->GetExpiredTime();
+	Bounded.SetExpiredEventsPolicy(Policy);
+	EXPECT_FALSE(Bounded.GetExpiredEvent(Expired[0]->GetGUID()).IsValid());
+	EXPECT_TRUE(Bounded.GetExpiredEvent(Expired[1]->GetGUID()).IsValid());
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldAdvanceLikeTickingEveryInterval)
+{
+	FNTimelineManager* CaughtUpTimer = new FNTimelineManager();
+	TArray<FNTimelineManager*> Timers = {Timer, CaughtUpTimer};
+	TArray<TArray<TSharedPtr<INEvent>>> TimersEvents;
+	TArray<TArray<FString>> TimersChanges;
+	TimersEvents.SetNum(2);
+	TimersChanges.SetNum(2);
+
+	for (int32 Idx = 0; Idx < 2; Idx++)
+	{
+		FNTimelineManager* Manager = Timers[Idx];
+		TSharedPtr<FNTimeline> Timeline = Manager->GetTimeline();
+		TArray<TSharedPtr<INEvent>>& ManagerEvents = TimersEvents[Idx];
+		TArray<FString>& Changes = TimersChanges[Idx];
+		Manager->OnEventChanged().AddLambda(
+			[Manager, &Changes](TSharedPtr<INEvent> Event, const ENTimelineEvent& EventName, const float& EventTime,
+			const int32& Index)
+			{
+				if (EventName == ENTimelineEvent::Start || EventName == ENTimelineEvent::Expired)
+				{
+					Changes.Add(FString::Printf(TEXT("%s %d %.2f"), *Event->GetEventLabel().ToString(),
+						static_cast<int32>(EventName), EventTime));
+				}
+				// A listener which attaches an event while catching up
+				if (EventName == ENTimelineEvent::Expired && Event->GetEventLabel() == FName("chain"))
+				{
+					Manager->GetTimeline()->Attached(Manager->CreateNewEvent(FName("chained"), 1.5f, 2.f));
+				}
+			}
+		);
+		Manager->Play();
+		ManagerEvents = {
+			Manager->CreateNewEvent(FName("endless")),
+			Manager->CreateNewEvent(FName("short"), 1.f),
+			Manager->CreateNewEvent(FName("delayed"), 2.5f, 3.f),
+			Manager->CreateNewEvent(FName("chain"), 4.f, 0.5f),
+			Manager->CreateNewEvent(FName("stopped"), 20.f),
+			Manager->CreateNewEvent(FName("late"), 2.f, 30.f),
+			MakeShareable(new FNUnboundEventFake(FName("unbound"), 6.f, 1.f)),
+			MakeShareable(new FNUnboundEventFake(FName("unbound endless"))),
+		};
+		for (const TSharedPtr<INEvent>& Event : ManagerEvents)
+		{
+			Timeline->Attached(Event);
+		}
+		Manager->TimerTick(1.f);
+		ManagerEvents[4]->Stop();
+	}
+
+	for (int32 Tick = 0; Tick < 10; Tick++)
+	{
+		Timer->TimerTick(1.f);
+	}
+	Timer->TimerTick(0.5f);
+	CaughtUpTimer->AdvanceBy(10.5f);
+
+	EXPECT_EQ(TimersChanges[0], TimersChanges[1]);
+
+	const TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	const TSharedPtr<FNTimeline> CaughtUpTimeline = CaughtUpTimer->GetTimeline();
+	EXPECT_FLOAT_EQ(Timeline->GetCurrentTime(), CaughtUpTimeline->GetCurrentTime());
+	EXPECT_EQ(Timeline->GetEvents().Num(), CaughtUpTimeline->GetEvents().Num());
+	EXPECT_EQ(Timeline->GetExpiredEvents().Num(), CaughtUpTimeline->GetExpiredEvents().Num());
+	for (int32 Idx = 0; Idx < TimersEvents[0].Num(); Idx++)
+	{
+		const TSharedPtr<INEvent>& Expected = TimersEvents[0][Idx];
+		const TSharedPtr<INEvent>& Event = TimersEvents[1][Idx];
+		EXPECT_FLOAT_EQ(Expected->GetLocalTime(), Event->GetLocalTime()) << TCHAR_TO_ANSI(*Expected->GetEventLabel().ToString());
+		EXPECT_FLOAT_EQ(Expected->GetStartedAt(), Event->GetStartedAt());
+		EXPECT_FLOAT_EQ(Expected->GetExpiredTime(), Event->GetExpiredTime());
+		EXPECT_EQ(Expected->IsExpired(), Event->IsExpired());
+	}
+	delete CaughtUpTimer;
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldCoalesceTicksWhenAdvancing)
+{
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	int32 NumTicks = 0;
+	Timer->OnEventsChanged(ENTimelineEvent::Tick).AddLambda(
+		[&NumTicks](TArrayView<const FNTimelineNotification> Notifications)
+		{
+			NumTicks += Notifications.Num();
+		}
+	);
+	Timer->Play();
+	Timeline->Attached(Timer->CreateNewEvent(FName("endless")));
+	Timeline->Attached(Timer->CreateNewEvent(FName("short"), 2.f));
+
+	Timer->AdvanceBy(100.f);
+	EXPECT_EQ(NumTicks, 0);
+
+	FNTimelineAdvancePolicy Policy;
+	Policy.bCoalesceTicks = true;
+	Timer->AdvanceBy(100.f, Policy);
+	EXPECT_EQ(NumTicks, 1);
+	EXPECT_EQ(Timeline->GetEvents()[0]->GetLocalTime(), 200.f);
+	EXPECT_EQ(Timeline->GetExpiredEvents()[0]->GetExpiredTime(), 2.f);
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldCatchUpTickByTickWithinABudget)
+{
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	int32 NumTicks = 0;
+	TArray<float> Progresses;
+	int32 NumCompleted = 0;
+	Timer->OnEventsChanged(ENTimelineEvent::Tick).AddLambda(
+		[&NumTicks](TArrayView<const FNTimelineNotification> Notifications)
+		{
+			NumTicks++;
+		}
+	);
+	Timer->OnCatchUpProgressed().AddLambda([&Progresses](const float& Progress) { Progresses.Add(Progress); });
+	Timer->OnCatchUpCompleted().AddLambda([&NumCompleted]() { NumCompleted++; });
+	Timer->Play();
+	// The endless one is ticked at each interval
+	Timeline->Attached(Events[0]);
+	Timeline->Attached(Events[3]);
+	EXPECT_FALSE(Timeline->IsCatchingUp());
+	EXPECT_TRUE(Timer->CatchUp(FNTimelineCatchUpBudget()));
+
+	FNTimelineCatchUpBudget Budget;
+	Budget.MaxTicks = 3;
+	Timer->StartCatchUp(10.f);
+	EXPECT_TRUE(Timeline->IsCatchingUp());
+	EXPECT_EQ(Timeline->GetCatchUpProgress(), 0.f);
+
+	EXPECT_FALSE(Timer->CatchUp(Budget));
+	EXPECT_EQ(Timeline->GetCurrentTime(), 3.f);
+	EXPECT_EQ(NumTicks, 3);
+	EXPECT_TRUE(Timeline->IsCatchingUp());
+	EXPECT_FLOAT_EQ(Timeline->GetCatchUpRemainingTime(), 7.f);
+
+	// Time can be queued while catching up
+	Timer->StartCatchUp(0.5f);
+	EXPECT_FALSE(Timer->CatchUp(Budget));
+	EXPECT_TRUE(Events[3]->IsExpired());
+	EXPECT_EQ(Events[3]->GetExpiredTime(), 4.f);
+	EXPECT_FALSE(Timer->CatchUp(Budget));
+	EXPECT_TRUE(Timer->CatchUp(Budget));
+	EXPECT_FALSE(Timeline->IsCatchingUp());
+	EXPECT_FLOAT_EQ(Timeline->GetCurrentTime(), 10.5f);
+	EXPECT_EQ(NumTicks, 11);
+
+	ASSERT_EQ(Progresses.Num(), 4);
+	EXPECT_FLOAT_EQ(Progresses[0], 0.3f);
+	EXPECT_EQ(Progresses[3], 1.f);
+	EXPECT_EQ(NumCompleted, 1);
+	EXPECT_EQ(Timeline->GetCatchUpProgress(), 1.f);
+
+	// Ticks are not replayed while the timeline is paused
+	Timer->StartCatchUp(2.f);
+	Timer->Pause();
+	EXPECT_FALSE(Timer->CatchUp(Budget));
+	EXPECT_FLOAT_EQ(Timeline->GetCurrentTime(), 10.5f);
+	Timer->Play();
+	EXPECT_TRUE(Timer->CatchUp(FNTimelineCatchUpBudget()));
+	EXPECT_FLOAT_EQ(Timeline->GetCurrentTime(), 12.5f);
+	EXPECT_EQ(NumCompleted, 2);
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldTickInParallelLikeTickingEachManager)
+{
+	const int32 NumManagers = 8;
+	// The first half is ticked one by one, the second half in parallel
+	TArray<FNTimelineManager*> Managers;
+	TArray<FString> Changes[2];
+	FNExpiredEventsPolicy Policy;
+	Policy.Retention = ENExpiredEventsRetention::Last;
+	Policy.MaxEvents = 2;
+	const uint32 GameThreadId = FPlatformTLS::GetCurrentThreadId();
+	bool bIsNotifiedOnCallingThread = true;
+
+	for (int32 Idx = 0; Idx < NumManagers * 2; Idx++)
+	{
+		FNTimelineManager* Manager = new FNTimelineManager();
+		Managers.Add(Manager);
+		TArray<FString>& ManagerChanges = Changes[Idx / NumManagers];
+		const int32 ManagerIdx = Idx % NumManagers;
+		Manager->OnEventChanged().AddLambda(
+			[Manager, ManagerIdx, GameThreadId, &ManagerChanges, &bIsNotifiedOnCallingThread](TSharedPtr<INEvent> Event,
+			const ENTimelineEvent& EventName, const float& EventTime, const int32& Index)
+			{
+				bIsNotifiedOnCallingThread &= FPlatformTLS::GetCurrentThreadId() == GameThreadId;
+				// Slots are released after the notifications, so Index is the same as when ticking each manager.
+				ManagerChanges.Add(FString::Printf(TEXT("%d %s %d %.2f %d"), ManagerIdx, *Event->GetEventLabel().ToString(),
+					static_cast<int32>(EventName), EventTime, Index));
+				if (EventName == ENTimelineEvent::Expired && Event->GetEventLabel() == FName("chain"))
+				{
+					Manager->GetTimeline()->Attached(Manager->CreateNewEvent(FName("chained"), 1.f));
+				}
+			}
+		);
+		Manager->GetTimeline()->SetExpiredEventsPolicy(Policy);
+		Manager->GetTimeline()->SetPoolCapacity(4);
+		Manager->OnExpiredEventEvicted().AddLambda(
+			[ManagerIdx, &ManagerChanges](const FGuid& UID)
+			{
+				ManagerChanges.Add(FString::Printf(TEXT("%d evicted"), ManagerIdx));
+			}
+		);
+		Manager->Play();
+		for (int32 EventIdx = 0; EventIdx < 20; EventIdx++)
+		{
+			Manager->GetTimeline()->Attached(Manager->CreateNewEvent(
+				FName(EventIdx == ManagerIdx ? "chain" : "event"), (EventIdx + ManagerIdx) % 5, EventIdx % 3)
+			);
+		}
+	}
+	// A paused one is not ticked
+	Managers[NumManagers * 2 - 1]->Pause();
+	Managers[NumManagers - 1]->Pause();
+
+	for (int32 Tick = 0; Tick < 10; Tick++)
+	{
+		TArray<FNTimelineTickRequest> Requests;
+		for (int32 Idx = 0; Idx < NumManagers; Idx++)
+		{
+			Managers[Idx]->TimerTick(1.f);
+			Requests.Emplace(Managers[NumManagers + Idx], 1.f);
+		}
+		FNTimelineManager::TickInParallel(Requests);
+	}
+
+	EXPECT_TRUE(bIsNotifiedOnCallingThread);
+	EXPECT_EQ(Changes[0], Changes[1]);
+	for (int32 Idx = 0; Idx < NumManagers; Idx++)
+	{
+		const TSharedPtr<FNTimeline> Expected = Managers[Idx]->GetTimeline();
+		const TSharedPtr<FNTimeline> Timeline = Managers[NumManagers + Idx]->GetTimeline();
+		EXPECT_EQ(Expected->GetCurrentTime(), Timeline->GetCurrentTime());
+		EXPECT_EQ(Expected->GetEvents().Num(), Timeline->GetEvents().Num());
+		EXPECT_EQ(Expected->GetExpiredEvents().Num(), Timeline->GetExpiredEvents().Num());
+		EXPECT_EQ(Expected->GetPoolStats().Recycled, Timeline->GetPoolStats().Recycled);
+	}
+	EXPECT_GT(Managers[NumManagers]->GetTimeline()->GetPoolStats().Recycled, 0);
+	EXPECT_EQ(Managers[NumManagers * 2 - 1]->GetTimeline()->GetCurrentTime(), 0.f);
+
+	for (FNTimelineManager* Manager : Managers)
+	{
+		delete Manager;
+	}
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldSweepInParallelLikeSerially)
+{
+	constexpr int32 NumEvents = 20000;
+	for (const ENTimelineStorage& Storage : {ENTimelineStorage::Objects, ENTimelineStorage::Packed})
+	{
+		// The first one is ticked serially
+		FNTimelineManager* Managers[2] = {new FNTimelineManager(), new FNTimelineManager()};
+		TArray<FString> Changes[2];
+		for (int32 Idx = 0; Idx < 2; Idx++)
+		{
+			TSharedPtr<FNTimeline> Timeline = Managers[Idx]->GetTimeline();
+			Timeline->SetStorage(Storage);
+			Timeline->SetParallelSweepThreshold(Idx == 0 ? 0 : 1);
+			TArray<FString>& ManagerChanges = Changes[Idx];
+			for (const ENTimelineEvent& EventName : {ENTimelineEvent::Start, ENTimelineEvent::Tick, ENTimelineEvent::Expired})
+			{
+				Managers[Idx]->OnEventsChanged(EventName).AddLambda(
+					[&ManagerChanges](TArrayView<const FNTimelineNotification> Notifications)
+					{
+						for (const FNTimelineNotification& Notification : Notifications)
+						{
+							ManagerChanges.Add(FString::Printf(TEXT("%d %d %.2f"), static_cast<int32>(Notification.EventName),
+								Notification.Index, Notification.Time));
+						}
+					}
+				);
+			}
+			// A listener to each change, like UNTimelineManagerDecorator, doesn't prevent the parallel sweep.
+			Managers[Idx]->OnEventChanged().AddLambda(
+				[&ManagerChanges](TSharedPtr<INEvent> Event, const ENTimelineEvent& EventName, const float& EventTime,
+				const int32& Index)
+				{
+					ManagerChanges.Add(FString::Printf(TEXT("changed %d %d"), static_cast<int32>(EventName), Index));
+				}
+			);
+			Managers[Idx]->Play();
+			for (int32 EventIdx = 0; EventIdx < NumEvents; EventIdx++)
+			{
+				Timeline->Attached(Managers[Idx]->CreateNewEvent(NAME_None, EventIdx % 7, EventIdx % 3));
+			}
+			// Not created by the timeline, it is not packed
+			Timeline->Attached(MakeShareable(new FNEventFake(FName("fake"), 3.f)));
+		}
+
+		for (int32 Tick = 0; Tick < 8; Tick++)
+		{
+			if (Tick == 2)
+			{
+				// Stopped manually between 2 ticks
+				for (int32 Idx = 0; Idx < 2; Idx++)
+				{
+					TArray<TSharedPtr<INEvent>> RunningEvents = Managers[Idx]->GetTimeline()->GetEvents();
+					for (int32 EventIdx = 0; EventIdx < RunningEvents.Num(); EventIdx += 11)
+					{
+						RunningEvents[EventIdx]->Stop();
+					}
+				}
+			}
+			Managers[0]->TimerTick(1.f);
+			Managers[1]->TimerTick(1.f);
+		}
+
+		EXPECT_EQ(Changes[0].Num(), Changes[1].Num());
+		EXPECT_TRUE(Changes[0] == Changes[1]);
+		const TArray<TSharedPtr<INEvent>> ExpectedEvents = Managers[0]->GetTimeline()->GetEvents();
+		const TArray<TSharedPtr<INEvent>> Events = Managers[1]->GetTimeline()->GetEvents();
+		ASSERT_EQ(ExpectedEvents.Num(), Events.Num());
+		for (int32 Idx = 0; Idx < Events.Num(); Idx++)
+		{
+			EXPECT_EQ(ExpectedEvents[Idx]->GetLocalTime(), Events[Idx]->GetLocalTime());
+		}
+		const TArray<TSharedPtr<INEvent>> ExpectedExpiredEvents = Managers[0]->GetTimeline()->GetExpiredEvents();
+		const TArray<TSharedPtr<INEvent>> ExpiredEvents = Managers[1]->GetTimeline()->GetExpiredEvents();
+		ASSERT_EQ(ExpectedExpiredEvents.Num(), ExpiredEvents.Num());
+		for (int32 Idx = 0; Idx < ExpiredEvents.Num(); Idx++)
+		{
+			EXPECT_EQ(ExpectedExpiredEvents[Idx]->GetLocalTime(), ExpiredEvents[Idx]->GetLocalTime());
+			EXPECT_EQ(ExpectedExpiredEvents[Idx]->GetExpiredTime(), ExpiredEvents[Idx]->GetExpiredTime());
+		}
+		delete Managers[0];
+		delete Managers[1];
+	}
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, DISABLED_BenchmarkParallelSweepWith200kEvents)
+{
+	constexpr int32 NumEvents = 200000;
+	constexpr int32 NumTicks = 20;
+	TSharedPtr<FNTimeline> Timeline = Timer->GetTimeline();
+	Timer->Play();
+	for (int32 Idx = 0; Idx < NumEvents; Idx++)
+	{
+		Timeline->Attached(MakeShareable(new FNEventFake(NAME_None, 0.f)));
+	}
+
+	for (const int32& Threshold : {0, 1})
+	{
+		Timeline->SetParallelSweepThreshold(Threshold);
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Tick = 0; Tick < NumTicks; Tick++)
+		{
+			Timer->TimerTick(1.f);
+		}
+		std::cout << "[ BENCH    ] " << NumEvents << " events, " << (Threshold > 0 ? "parallel" : "serial") << " sweep: "
+			<< (FPlatformTime::Seconds() - StartTime) * 1000.f / NumTicks << "ms/tick" << std::endl;
+	}
+	EXPECT_EQ(Timeline->GetEvents()[0]->GetLocalTime(), 2.f * NumTicks);
+}
+
+/** Checks the queued events are attached before OnNotifyTimelineTickBefore() */
+class FNTimelineManagerSubmissionsFake : public FNTimelineManager
+{
+public:
+	int32 NumEventsBeforeTick = INDEX_NONE;
+
+protected:
+	virtual void OnNotifyTimelineTickBefore(const float& InDeltaTime) override
+	{
+		NumEventsBeforeTick = Timeline->GetEvents().Num();
+	}
+};
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldAttachQueuedEventsAtTheStartOfTheNextTick)
+{
+	FNTimelineManagerSubmissionsFake* Manager = new FNTimelineManagerSubmissionsFake();
+	Manager->Play();
+	const FGuid UID = Manager->EnqueueNewEvent(FName("queued"), 2.f, 1.f);
+	Manager->EnqueueAttach(MakeShareable(new FNEventFake(FName("fake"))));
+	EXPECT_EQ(Manager->GetTimeline()->GetEvents().Num(), 0);
+
+	Manager->TimerTick(1.f);
+	EXPECT_EQ(Manager->NumEventsBeforeTick, 2);
+	const TSharedPtr<INEvent> Event = Manager->GetTimeline()->GetEvent(UID);
+	ASSERT_TRUE(Event.IsValid());
+	EXPECT_EQ(Event->GetEventLabel(), FName("queued"));
+	EXPECT_EQ(Event->GetDuration(), 2.f);
+	EXPECT_EQ(Event->GetDelay(), 1.f);
+	EXPECT_EQ(Event->GetAttachedTime(), 0.f);
+	EXPECT_EQ(Manager->DrainSubmissions(), 0);
+	delete Manager;
+}
+
+/**
+ * Queues events from NumProducers threads while Manager ticks, then checks they are all attached in their order.
+ * @returns the number of ticks which have drained them
+ */
+int32 TickWhileThreadsQueueEvents(FNTimelineManager* Manager, const int32& NumProducers, const int32& NumEventsPerProducer)
+{
+	TSharedPtr<FNTimeline> Timeline = Manager->GetTimeline();
+	Manager->Play();
+
+	TArray<TArray<FGuid>> ProducerUIDs;
+	ProducerUIDs.SetNum(NumProducers);
+	FThreadSafeCounter NumStarted;
+	TArray<TFuture<void>> Producers;
+	for (int32 Producer = 0; Producer < NumProducers; Producer++)
+	{
+		Producers.Add(Async(
+			EAsyncExecution::Thread, [Manager, Producer, NumEventsPerProducer, &ProducerUIDs, &NumStarted]()
+			{
+				NumStarted.Increment();
+				for (int32 Idx = 0; Idx < NumEventsPerProducer; Idx++)
+				{
+					// The number of the label is the order of the request
+					const FName Label(*FString::Printf(TEXT("P%d"), Producer), Idx + 1);
+					if (Idx % 2 == 0)
+					{
+						ProducerUIDs[Producer].Add(Manager->EnqueueNewEvent(Label));
+					}
+					else
+					{
+						Manager->EnqueueAttach(MakeShareable(new FNEventFake(Label)));
+					}
+				}
+			}
+		));
+	}
+
+	// Drained while producers are still queuing
+	int32 NumTicks = 0;
+	const auto AreProducersDone = [&Producers]()
+	{
+		return Producers.FindByPredicate([](const TFuture<void>& Producer) { return !Producer.IsReady(); }) == nullptr;
+	};
+	while (NumStarted.GetValue() < NumProducers || !AreProducersDone())
+	{
+		Manager->TimerTick(1.f);
+		NumTicks++;
+		FPlatformProcess::Sleep(0.f);
+	}
+	Manager->TimerTick(1.f);
+	NumTicks++;
+
+	const TArray<TSharedPtr<INEvent>> AttachedEvents = Timeline->GetEvents();
+	EXPECT_EQ(AttachedEvents.Num(), NumProducers * NumEventsPerProducer);
+	for (const TArray<FGuid>& UIDs : ProducerUIDs)
+	{
+		for (const FGuid& UID : UIDs)
+		{
+			EXPECT_TRUE(Timeline->GetEvent(UID).IsValid());
+		}
+	}
+
+	// Events never expire, so they are in their attachment order
+	TMap<FName, int32> LastNumbers;
+	for (const TSharedPtr<INEvent>& Event : AttachedEvents)
+	{
+		const FName Label = Event->GetEventLabel();
+		int32& LastNumber = LastNumbers.FindOrAdd(FName(Label, 0));
+		EXPECT_GT(Label.GetNumber(), LastNumber);
+		LastNumber = Label.GetNumber();
+	}
+	EXPECT_EQ(LastNumbers.Num(), NumProducers);
+	return NumTicks;
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, ShouldAttachEventsQueuedByManyThreadsWhileTicking)
+{
+	TickWhileThreadsQueueEvents(Timer, 4, 500);
+}
+
+TEST_F(NansTimelineSystemCoreTimelineTest, DISABLED_BenchmarkAttachEventsQueuedBy16Threads)
+{
+	constexpr int32 NumProducers = 16;
+	constexpr int32 NumEventsPerProducer = 5000;
+	const int32 NumTicks = TickWhileThreadsQueueEvents(Timer, NumProducers, NumEventsPerProducer);
+	std::cout << "[ BENCH    ] " << NumProducers * NumEventsPerProducer << " events queued by " << NumProducers
+		<< " threads, drained by " << NumTicks << " ticks" << std::endl;
+}
@@ -0,0 +1,88 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "ClockSource.h"
+
+double FNMonotonicClockSource::GetSeconds() const
+{
+	return FPlatformTime::Seconds();
+}
+
+double FNWallClockSource::GetSeconds() const
+{
+	return static_cast<double>(FDateTime::UtcNow().GetTicks()) / ETimespan::TicksPerSecond;
+}
+
+double FNTestClockSource::GetSeconds() const
+{
+	return Seconds;
+}
+
+void FNTestClockSource::Advance(const double& InSeconds)
+{
+	Seconds += InSeconds;
+}
+
+void FNTestClockSource::SetSeconds(const double& InSeconds)
+{
+	Seconds = InSeconds;
+}
+
+FNClockAccumulator::FNClockAccumulator() : FNClockAccumulator(MakeShared<FNMonotonicClockSource>()) {}
+
+FNClockAccumulator::FNClockAccumulator(const TSharedRef<INClockSource>& InSource) : Source(InSource)
+{
+	Reset();
+}
+
+void FNClockAccumulator::SetSource(const TSharedRef<INClockSource>& InSource)
+{
+	Source = InSource;
+	Reset();
+}
+
+TSharedRef<INClockSource> FNClockAccumulator::GetSource() const
+{
+	return Source;
+}
+
+void FNClockAccumulator::Reset()
+{
+	LastSeconds = Source->GetSeconds();
+	Accumulated = 0.;
+}
+
+double FNClockAccumulator::Sample()
+{
+	const double Now = Source->GetSeconds();
+	if (Now > LastSeconds)
+	{
+		Accumulated += Now - LastSeconds;
+	}
+	LastSeconds = Now;
+	return Accumulated;
+}
+
+double FNClockAccumulator::GetAccumulated() const
+{
+	return Accumulated;
+}
+
+double FNClockAccumulator::Consume()
+{
+	const double Consumed = Accumulated;
+	Accumulated = 0.;
+	return Consumed;
+}
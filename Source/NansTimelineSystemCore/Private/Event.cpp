@@ -14,25 +14,21 @@
 
 #include "Event.h"
 
-FNEvent::FNEvent()
+FNEvent::FNEvent() : UId(FGuid::NewGuid()) {}
+
+FNEvent::FNEvent(const FName& InLabel, const FString& InUId)
 {
-	if (UId.IsEmpty())
+	Label = InLabel;
+	if (InUId.IsEmpty() || !FGuid::Parse(InUId, UId))
 	{
-		UId = FGuid::NewGuid().ToString();
+		UId = FGuid::NewGuid();
 	}
 }
 
-FNEvent::FNEvent(const FName& InLabel, const FString& InUId)
+FNEvent::FNEvent(const FName& InLabel, const FGuid& InUId)
 {
 	Label = InLabel;
-	if (!InUId.IsEmpty())
-	{
-		UId = InUId;
-	}
-	else
-	{
-		UId = FGuid::NewGuid().ToString();
-	}
+	UId = InUId.IsValid() ? InUId : FGuid::NewGuid();
 }
 
 bool FNEvent::IsExpired() const
@@ -42,6 +38,10 @@ bool FNEvent::IsExpired() const
 
 float FNEvent::GetLocalTime() const
 {
+	if (Clock.IsValid())
+	{
+		return static_cast<float>(Clock->Time - ClockOrigin);
+	}
 	return LocalTime;
 }
 
@@ -86,6 +86,11 @@ FName FNEvent::GetEventLabel() const
 }
 
 FString FNEvent::GetUID() const
+{
+	return UId.ToString();
+}
+
+FGuid FNEvent::GetGUID() const
 {
 	return UId;
 }
@@ -128,12 +133,35 @@ void FNEvent::Stop()
 
 void FNEvent::AddTime(const float& NewTime)
 {
+	if (Clock.IsValid())
+	{
+		ClockOrigin -= NewTime;
+		return;
+	}
 	LocalTime += NewTime;
 }
 
+bool FNEvent::BindClock(const TSharedRef<const FNTimelineClock>& InClock)
+{
+	if (!ShouldBindClock()) return false;
+	ClockOrigin = InClock->Time - LocalTime;
+	Clock = InClock;
+	return true;
+}
+
+void FNEvent::UnbindClock(const float& InTime)
+{
+	if (!Clock.IsValid()) return;
+	// The float time loses the clock precision, the clock is read directly when it is the current time.
+	const double Time = InTime == static_cast<float>(Clock->Time) ? Clock->Time : InTime;
+	LocalTime = static_cast<float>(Time - ClockOrigin);
+	Clock.Reset();
+}
+
 void FNEvent::Clear()
 {
 	Label = NAME_None;
+	Clock.Reset();
 	LocalTime = 0.f;
 	StartedAt = -1.f;
 	Duration = 0.f;
@@ -142,13 +170,55 @@ void FNEvent::Clear()
 
 void FNEvent::Archive(FArchive& Ar)
 {
-	Ar << UId;
+	// Kept as a string to stay compatible with previous saves.
+	FString UIdString;
+	if (Ar.IsSaving())
+	{
+		UIdString = UId.ToString();
+	}
+	Ar << UIdString;
+	if (Ar.IsLoading())
+	{
+		FGuid::Parse(UIdString, UId);
+	}
 	Ar << AttachedTime;
 	Ar << Delay;
 	Ar << Duration;
+	if (Ar.IsSaving() && Clock.IsValid())
+	{
+		LocalTime = GetLocalTime();
+	}
 	Ar << LocalTime;
+	if (Ar.IsLoading() && Clock.IsValid())
+	{
+		ClockOrigin = Clock->Time - LocalTime;
+	}
 	Ar << StartedAt;
 	Ar << Label;
 	Ar << ExpiredTime;
 	Ar << bActivated;
 }
+
+void FNEvent::ArchiveRecord(FNTimelineArchive& Ar)
+{
+	Ar << UId;
+	Ar << Label;
+	// A bool is written on 4 bytes
+	uint8 Activated = bActivated ? 1 : 0;
+	Ar << Activated;
+	bActivated = Activated != 0;
+	Ar.SerializeAttachedTime(AttachedTime);
+	Ar.SerializeTime(Delay);
+	Ar.SerializeTime(Duration);
+	if (Ar.IsSaving() && Clock.IsValid())
+	{
+		LocalTime = GetLocalTime();
+	}
+	Ar.SerializeTime(LocalTime);
+	if (Ar.IsLoading() && Clock.IsValid())
+	{
+		ClockOrigin = Clock->Time - LocalTime;
+	}
+	Ar.SerializeTime(StartedAt);
+	Ar.SerializeTime(ExpiredTime);
+}
@@ -0,0 +1,455 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "EventStore.h"
+
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+
+bool FNEventStore::bVectorKernelEnabled = true;
+
+namespace
+{
+	/** @see FNEventStore::AdvanceScalar(), for indexes in [Begin, End) */
+	void AdvanceScalarRange(
+		float* LocalTimes, float* PreviousLocalTimes, const float* Steps, const float* Durations, const int32 Begin,
+		const int32 End, const float& InDeltaTime, uint32* OutExpiredBits
+	)
+	{
+		for (int32 Idx = Begin; Idx < End; Idx++)
+		{
+			PreviousLocalTimes[Idx] = LocalTimes[Idx];
+			// Same operations as the vector kernel (multiply then add) to get the same rounding.
+			const float Step = InDeltaTime * Steps[Idx];
+			LocalTimes[Idx] = LocalTimes[Idx] + Step;
+			if (Steps[Idx] != 0.f && Durations[Idx] > 0.f && LocalTimes[Idx] >= Durations[Idx])
+			{
+				OutExpiredBits[Idx >> 5] |= 1u << (Idx & 31);
+			}
+		}
+	}
+}
+
+int32 FNEventStore::Allocate(const FName& InLabel, const FGuid& InUId)
+{
+	int32 Index;
+	if (FreeIndexes.Num() > 0)
+	{
+		Index = FreeIndexes.Pop(false);
+	}
+	else
+	{
+		Index = Flags.AddUninitialized();
+		AttachedTimes.AddUninitialized();
+		LocalTimes.AddUninitialized();
+		PreviousLocalTimes.AddUninitialized();
+		Steps.AddUninitialized();
+		StartedAts.AddUninitialized();
+		ExpiredTimes.AddUninitialized();
+		Durations.AddUninitialized();
+		Delays.AddUninitialized();
+		Labels.AddUninitialized();
+		UIds.AddUninitialized();
+	}
+
+	Reset(Index, InLabel, InUId);
+	return Index;
+}
+
+void FNEventStore::Reset(const int32& Index, const FName& InLabel, const FGuid& InUId)
+{
+	AttachedTimes[Index] = 0.f;
+	LocalTimes[Index] = 0.f;
+	PreviousLocalTimes[Index] = 0.f;
+	Steps[Index] = 0.f;
+	StartedAts[Index] = -1.f;
+	ExpiredTimes[Index] = -1.f;
+	Durations[Index] = 0.f;
+	Delays[Index] = 0.f;
+	Flags[Index] = Allocated | Attachable;
+	Labels[Index] = InLabel;
+	UIds[Index] = InUId.IsValid() ? InUId : FGuid::NewGuid();
+}
+
+void FNEventStore::Free(const int32& Index)
+{
+	if (!IsValidIndex(Index)) return;
+	Flags[Index] = 0;
+	Steps[Index] = 0.f;
+	FreeIndexes.Add(Index);
+}
+
+void FNEventStore::Clear(const int32& Index)
+{
+	Labels[Index] = NAME_None;
+	LocalTimes[Index] = 0.f;
+	Steps[Index] = 0.f;
+	StartedAts[Index] = -1.f;
+	Durations[Index] = 0.f;
+	Delays[Index] = 0.f;
+}
+
+FNEventStore::FValues FNEventStore::GetValues(const int32& Index) const
+{
+	FValues OutValues;
+	OutValues.AttachedTime = AttachedTimes[Index];
+	OutValues.LocalTime = LocalTimes[Index];
+	OutValues.StartedAt = StartedAts[Index];
+	OutValues.ExpiredTime = ExpiredTimes[Index];
+	OutValues.Duration = Durations[Index];
+	OutValues.Delay = Delays[Index];
+	OutValues.Flags = Flags[Index] & ~Allocated;
+	OutValues.Label = Labels[Index];
+	OutValues.UId = UIds[Index];
+	return OutValues;
+}
+
+void FNEventStore::SetValues(const int32& Index, const FValues& InValues)
+{
+	AttachedTimes[Index] = InValues.AttachedTime;
+	LocalTimes[Index] = InValues.LocalTime;
+	StartedAts[Index] = InValues.StartedAt;
+	ExpiredTimes[Index] = InValues.ExpiredTime;
+	Durations[Index] = InValues.Duration;
+	Delays[Index] = InValues.Delay;
+	Flags[Index] = InValues.Flags | Allocated;
+	Labels[Index] = InValues.Label;
+	UIds[Index] = InValues.UId;
+}
+
+void FNEventStore::Advance(const float& InDeltaTime, TArray<uint32>& OutExpiredBits, const int32& ChunkSize)
+{
+	OutExpiredBits.Reset();
+	OutExpiredBits.AddZeroed((Flags.Num() + 31) / 32);
+	const auto AdvanceRange = [this, &InDeltaTime, &OutExpiredBits](const int32& Begin, const int32& Num)
+	{
+		// Begin is a multiple of 32, so a range has its own words of OutExpiredBits.
+		(bVectorKernelEnabled ? AdvanceVector : AdvanceScalar)(
+			LocalTimes.GetData() + Begin, PreviousLocalTimes.GetData() + Begin, Steps.GetData() + Begin,
+			Durations.GetData() + Begin, Num, InDeltaTime, OutExpiredBits.GetData() + (Begin >> 5)
+		);
+	};
+
+	if (ChunkSize <= 0 || Flags.Num() <= ChunkSize)
+	{
+		AdvanceRange(0, Flags.Num());
+		return;
+	}
+
+	const int32 AlignedChunkSize = Align(ChunkSize, 32);
+	const int32 NumChunks = FMath::DivideAndRoundUp(Flags.Num(), AlignedChunkSize);
+	ParallelFor(
+		NumChunks, [this, &AdvanceRange, &AlignedChunkSize](int32 Chunk)
+		{
+			const int32 Begin = Chunk * AlignedChunkSize;
+			AdvanceRange(Begin, FMath::Min(AlignedChunkSize, Flags.Num() - Begin));
+		}
+	);
+}
+
+void FNEventStore::AdvanceScalar(
+	float* LocalTimes, float* PreviousLocalTimes, const float* Steps, const float* Durations, const int32& Num,
+	const float& InDeltaTime, uint32* OutExpiredBits
+)
+{
+	AdvanceScalarRange(LocalTimes, PreviousLocalTimes, Steps, Durations, 0, Num, InDeltaTime, OutExpiredBits);
+}
+
+void FNEventStore::AdvanceVector(
+	float* LocalTimes, float* PreviousLocalTimes, const float* Steps, const float* Durations, const int32& Num,
+	const float& InDeltaTime, uint32* OutExpiredBits
+)
+{
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	const VectorRegister Delta = VectorSetFloat1(InDeltaTime);
+	const VectorRegister Zero = VectorZero();
+	const int32 NumVectors = Num & ~3;
+
+	for (int32 Idx = 0; Idx < NumVectors; Idx += 4)
+	{
+		const VectorRegister Local = VectorLoad(LocalTimes + Idx);
+		const VectorRegister Step = VectorLoad(Steps + Idx);
+		const VectorRegister Duration = VectorLoad(Durations + Idx);
+		const VectorRegister NewLocal = VectorAdd(Local, VectorMultiply(Delta, Step));
+		VectorStore(Local, PreviousLocalTimes + Idx);
+		VectorStore(NewLocal, LocalTimes + Idx);
+
+		const VectorRegister Expired = VectorBitwiseAnd(
+			VectorBitwiseAnd(VectorCompareNE(Step, Zero), VectorCompareGT(Duration, Zero)),
+			VectorCompareGE(NewLocal, Duration)
+		);
+		// Idx is a multiple of 4, the 4 bits never straddle two words.
+		OutExpiredBits[Idx >> 5] |= static_cast<uint32>(VectorMaskBits(Expired)) << (Idx & 31);
+	}
+
+	AdvanceScalarRange(LocalTimes, PreviousLocalTimes, Steps, Durations, NumVectors, Num, InDeltaTime, OutExpiredBits);
+#else
+	AdvanceScalar(LocalTimes, PreviousLocalTimes, Steps, Durations, Num, InDeltaTime, OutExpiredBits);
+#endif
+}
+
+bool FNEventStore::IsVectorKernelSupported()
+{
+	return PLATFORM_ENABLE_VECTORINTRINSICS != 0;
+}
+
+void FNEventStore::SetVectorKernelEnabled(const bool& bInEnabled)
+{
+	bVectorKernelEnabled = bInEnabled;
+}
+
+bool FNEventStore::IsVectorKernelEnabled()
+{
+	return bVectorKernelEnabled;
+}
+
+FNPackedEvent::FNPackedEvent(const TSharedRef<FNEventStore>& InStore, const FName& InLabel, const FGuid& InUId)
+	: Store(InStore), Index(InStore->Allocate(InLabel, InUId)) {}
+
+FNPackedEvent::~FNPackedEvent()
+{
+	if (HasIndex())
+	{
+		Store->Free(Index);
+	}
+}
+
+bool FNPackedEvent::IsExpired() const
+{
+	return HasIndex() ? Store->IsExpired(Index) : Values.IsExpired();
+}
+
+float FNPackedEvent::GetLocalTime() const
+{
+	return HasIndex() ? Store->LocalTimes[Index] : Values.LocalTime;
+}
+
+float FNPackedEvent::GetAttachedTime() const
+{
+	return HasIndex() ? Store->AttachedTimes[Index] : Values.AttachedTime;
+}
+
+float FNPackedEvent::GetStartedAt() const
+{
+	return HasIndex() ? Store->StartedAts[Index] : Values.StartedAt;
+}
+
+float FNPackedEvent::GetDuration() const
+{
+	return HasIndex() ? Store->Durations[Index] : Values.Duration;
+}
+
+float FNPackedEvent::GetDelay() const
+{
+	return HasIndex() ? Store->Delays[Index] : Values.Delay;
+}
+
+FString FNPackedEvent::GetUID() const
+{
+	return GetGUID().ToString();
+}
+
+FGuid FNPackedEvent::GetGUID() const
+{
+	return HasIndex() ? Store->UIds[Index] : Values.UId;
+}
+
+float FNPackedEvent::GetExpiredTime() const
+{
+	return HasIndex() ? Store->ExpiredTimes[Index] : Values.ExpiredTime;
+}
+
+FName FNPackedEvent::GetEventLabel() const
+{
+	return HasIndex() ? Store->Labels[Index] : Values.Label;
+}
+
+bool FNPackedEvent::IsAttachable() const
+{
+	return ((HasIndex() ? Store->Flags[Index] : Values.Flags) & FNEventStore::Attachable) != 0;
+}
+
+void FNPackedEvent::SetEventLabel(const FName& InEventLabel)
+{
+	(HasIndex() ? Store->Labels[Index] : Values.Label) = InEventLabel;
+}
+
+void FNPackedEvent::SetAttachedTime(const float& InLocalTime)
+{
+	(HasIndex() ? Store->AttachedTimes[Index] : Values.AttachedTime) = InLocalTime;
+}
+
+void FNPackedEvent::SetAttachable(const bool& bInIsAttachable)
+{
+	uint8& Flags = HasIndex() ? Store->Flags[Index] : Values.Flags;
+	if (bInIsAttachable)
+	{
+		Flags |= FNEventStore::Attachable;
+	}
+	else
+	{
+		Flags &= ~FNEventStore::Attachable;
+	}
+}
+
+void FNPackedEvent::SetExpiredTime(const float& InLocalTime)
+{
+	(HasIndex() ? Store->ExpiredTimes[Index] : Values.ExpiredTime) = InLocalTime;
+}
+
+void FNPackedEvent::SetDuration(const float& InDuration)
+{
+	(HasIndex() ? Store->Durations[Index] : Values.Duration) = InDuration;
+}
+
+void FNPackedEvent::SetDelay(const float& InDelay)
+{
+	(HasIndex() ? Store->Delays[Index] : Values.Delay) = InDelay;
+}
+
+void FNPackedEvent::Start(const float& StartTime)
+{
+	if (!HasIndex())
+	{
+		Values.StartedAt = StartTime;
+		Values.Flags |= FNEventStore::Activated;
+		return;
+	}
+	Store->StartedAts[Index] = StartTime;
+	Store->Flags[Index] |= FNEventStore::Activated;
+}
+
+void FNPackedEvent::Stop()
+{
+	if (!HasIndex())
+	{
+		Values.Flags &= ~FNEventStore::Activated;
+		return;
+	}
+	Store->Flags[Index] &= ~FNEventStore::Activated;
+	Store->Steps[Index] = 0.f;
+}
+
+void FNPackedEvent::AddTime(const float& NewTime)
+{
+	(HasIndex() ? Store->LocalTimes[Index] : Values.LocalTime) += NewTime;
+}
+
+void FNPackedEvent::Clear()
+{
+	if (!HasIndex())
+	{
+		Values.Label = NAME_None;
+		Values.LocalTime = 0.f;
+		Values.StartedAt = -1.f;
+		Values.Duration = 0.f;
+		Values.Delay = 0.f;
+		return;
+	}
+	Store->Clear(Index);
+}
+
+void FNPackedEvent::Archive(FArchive& Ar)
+{
+	// Same layout as FNEvent::Archive(), both can be loaded from the other one saves.
+	FNEventStore::FValues Record = HasIndex() ? Store->GetValues(Index) : Values;
+	FString UIdString;
+	if (Ar.IsSaving())
+	{
+		UIdString = Record.UId.ToString();
+	}
+	Ar << UIdString;
+	if (Ar.IsLoading())
+	{
+		FGuid::Parse(UIdString, Record.UId);
+	}
+	Ar << Record.AttachedTime;
+	Ar << Record.Delay;
+	Ar << Record.Duration;
+	Ar << Record.LocalTime;
+	Ar << Record.StartedAt;
+	Ar << Record.Label;
+	Ar << Record.ExpiredTime;
+	bool bActivated = (Record.Flags & FNEventStore::Activated) != 0;
+	Ar << bActivated;
+	if (Ar.IsLoading())
+	{
+		SetRecord(Record, bActivated);
+	}
+}
+
+void FNPackedEvent::ArchiveRecord(FNTimelineArchive& Ar)
+{
+	// Same layout as FNEvent::ArchiveRecord()
+	FNEventStore::FValues Record = HasIndex() ? Store->GetValues(Index) : Values;
+	Ar << Record.UId;
+	Ar << Record.Label;
+	uint8 Activated = (Record.Flags & FNEventStore::Activated) != 0 ? 1 : 0;
+	Ar << Activated;
+	Ar.SerializeAttachedTime(Record.AttachedTime);
+	Ar.SerializeTime(Record.Delay);
+	Ar.SerializeTime(Record.Duration);
+	Ar.SerializeTime(Record.LocalTime);
+	Ar.SerializeTime(Record.StartedAt);
+	Ar.SerializeTime(Record.ExpiredTime);
+	if (Ar.IsLoading())
+	{
+		SetRecord(Record, Activated != 0);
+	}
+}
+
+bool FNPackedEvent::Recycle(const FName& InLabel, const FGuid& InUId)
+{
+	if (!HasIndex())
+	{
+		Index = Store->Allocate(InLabel, InUId);
+		return true;
+	}
+	Store->Reset(Index, InLabel, InUId);
+	return true;
+}
+
+const FNEventStore* FNPackedEvent::GetStore(int32& OutIndex) const
+{
+	OutIndex = Index;
+	return HasIndex() ? &Store.Get() : nullptr;
+}
+
+void FNPackedEvent::ReleaseStore()
+{
+	if (!HasIndex()) return;
+	Values = Store->GetValues(Index);
+	Store->Free(Index);
+	Index = INDEX_NONE;
+}
+
+void FNPackedEvent::SetRecord(FNEventStore::FValues& Record, const bool& bActivated)
+{
+	if (bActivated)
+	{
+		Record.Flags |= FNEventStore::Activated;
+	}
+	else
+	{
+		Record.Flags &= ~FNEventStore::Activated;
+	}
+	if (HasIndex())
+	{
+		Store->SetValues(Index, Record);
+	}
+	else
+	{
+		Values = Record;
+	}
+}
@@ -14,25 +14,104 @@
 
 #include "Timeline.h"
 
+#include "Async/ParallelFor.h"
 #include "Event.h"
 
 int32 FNTimeline::Counter = 0;
 
-FNTimeline::FNTimeline()
+namespace
+{
+	/** Orders FNTimeline::PendingEvents slots by start time, then by attachment order. */
+	struct FNPendingEventPredicate
+	{
+		FNPendingEventPredicate(const TSparseArray<FNTimelineEventEntry>& InEvents) : Events(InEvents) {}
+
+		bool operator()(const int32& SlotA, const int32& SlotB) const
+		{
+			const FNTimelineEventEntry& A = Events[SlotA];
+			const FNTimelineEventEntry& B = Events[SlotB];
+			return A.StartTime < B.StartTime || (A.StartTime == B.StartTime && A.Sequence < B.Sequence);
+		}
+
+		const TSparseArray<FNTimelineEventEntry>& Events;
+	};
+
+	/** A Start or an Expired notification computed by FNTimeline::AdvanceBy() */
+	struct FNCatchUpChange
+	{
+		FNCatchUpChange(const int32& InTick, const int32& InSequence, const int32& InSlot,
+			const ENTimelineEvent& InEventName, const bool& bInIsStopped = false)
+			: Tick(InTick), Sequence(InSequence), Slot(InSlot), EventName(InEventName), bIsStopped(bInIsStopped) {}
+
+		/** The tick of AdvanceBy() it happens at */
+		int32 Tick;
+		int32 Sequence;
+		int32 Slot;
+		ENTimelineEvent EventName;
+
+		/** true for an event stopped with INEvent::Stop() */
+		bool bIsStopped;
+
+		/** Same order than NotifyTick(): by tick, then by attachment order */
+		bool operator<(const FNCatchUpChange& Other) const
+		{
+			return Tick < Other.Tick || (Tick == Other.Tick && Sequence < Other.Sequence);
+		}
+	};
+
+	/** The FNEvent created by FNTimeline::CreateEvent(), unlike any FNEvent subclass it can be pooled and reads the timeline clock. */
+	class FNTimelineEvent final : public FNEvent
+	{
+	public:
+		FNTimelineEvent(const FName& InLabel, const FGuid& InUId) : FNEvent(InLabel, InUId) {}
+
+		virtual bool Recycle(const FName& InLabel, const FGuid& InUId) override
+		{
+			Clear();
+			Label = InLabel;
+			UId = InUId.IsValid() ? InUId : FGuid::NewGuid();
+			AttachedTime = 0.f;
+			ExpiredTime = -1.f;
+			ClockOrigin = 0.;
+			bActivated = false;
+			bIsAttachable = true;
+			return true;
+		}
+
+	protected:
+		virtual bool ShouldBindClock() const override
+		{
+			return true;
+		}
+	};
+}
+
+FNTimeline::FNTimeline() : EventStore(MakeShared<FNEventStore>()), Clock(MakeShared<FNTimelineClock>())
 {
 	Label = FName(*FString::Format(TEXT("Timeline_{0}"), {Counter++}));
 }
 
-FNTimeline::FNTimeline(const FName& InLabel)
+FNTimeline::FNTimeline(const FName& InLabel, const ENTimelineStorage& InStorage)
+	: Storage(InStorage), EventStore(MakeShared<FNEventStore>()), Clock(MakeShared<FNTimelineClock>())
 {
 	Label = InLabel;
 }
 
 FNTimeline::~FNTimeline()
 {
+	ResetSchedule();
 	Events.Empty();
 	ExpiredEvents.Empty();
+	EventSlotsByUID.Empty();
+	ExpiredEventIndexesByUID.Empty();
 	EventChanged.Clear();
+	ExpiredEventEvicted.Clear();
+	CatchUpProgressed.Clear();
+	CatchUpCompleted.Clear();
+	for (FNTimelineEventBatchDelegate& Delegate : EventsChanged)
+	{
+		Delegate.Clear();
+	}
 }
 
 void FNTimeline::Attached(const TArray<TSharedPtr<INEvent>>& EventsCollection)
@@ -45,87 +124,780 @@ void FNTimeline::Attached(const TArray<TSharedPtr<INEvent>>& EventsCollection)
 
 bool FNTimeline::Attached(const TSharedPtr<INEvent>& Event)
 {
-	EventChanged.Broadcast(Event, ENTimelineEvent::BeforeAttached, CurrentTime, -1);
+	Notify(Event, ENTimelineEvent::BeforeAttached, CurrentTime, -1);
 	if (Event->IsAttachable())
 	{
 		Event->SetAttachedTime(CurrentTime);
 
-		Events.Add(Event);
-		// TODO remove this unuseful index
-		const int32 NewIndex = Events.Num() + 1;
+		const int32 Slot = AddEventEntry(Event);
 
 		if (Event->GetDelay() <= 0.f)
 		{
-			StartEvent(Event, NewIndex);
+			// Added before being started, so an event attached by a listener will be placed after this one.
+			RunningEvents.Add(Slot);
+			StartEvent(Slot);
+		}
+		else
+		{
+			Events[Slot].StartTime = CurrentTime + Event->GetDelay();
+			ScheduleEvent(Slot);
 		}
 
-		EventChanged.Broadcast(Event, ENTimelineEvent::AfterAttached, CurrentTime, NewIndex);
+		Notify(Event, ENTimelineEvent::AfterAttached, CurrentTime, Slot);
+	}
+	if (!bIsTicking)
+	{
+		FlushNotifications();
 	}
 	return Event->IsAttachable();
 }
 
-void FNTimeline::StartEvent(const TSharedPtr<INEvent>& Event, const int32& Index) const
+void FNTimeline::StartEvent(const int32& Slot)
 {
+	const TSharedPtr<INEvent> Event = Events[Slot].Event;
+
 	Event->Start(CurrentTime);
-	EventChanged.Broadcast(Event, ENTimelineEvent::Start, CurrentTime, Index);
+	Events[Slot].bIsClockBound = Event->BindClock(Clock);
+	if (Events[Slot].StoreIndex != INDEX_NONE && !Event->IsExpired())
+	{
+		// From now EventStore->Advance() increments its LocalTime
+		EventStore->Steps[Events[Slot].StoreIndex] = 1.f;
+	}
+	Notify(Event, ENTimelineEvent::Start, CurrentTime, Slot);
+}
+
+void FNTimeline::ScheduleEvent(const int32& Slot)
+{
+	PendingEvents.HeapPush(Slot, FNPendingEventPredicate(Events));
 }
 
 void FNTimeline::NotifyTick(const float& InDeltaTime)
 {
-	CurrentTime += InDeltaTime;
+	const float PreviousTime = CurrentTime;
+	bIsTicking = true;
+	bIsTickObserved = EventChanged.IsBound()
+					  || EventsChanged[static_cast<int32>(ENTimelineEvent::Tick)].IsBound();
+	Clock->Time += InDeltaTime;
+	CurrentTime = static_cast<float>(Clock->Time);
+	// Events are advanced before they are notified, the notifications are sent in order by the sweep below.
+	const bool bParallelSweep = ParallelSweepThreshold > 0 && RunningEvents.Num() >= ParallelSweepThreshold;
 
-	// TODO remove this index not useful anymore
-	int32 Index = 0;
-	TArray<TSharedPtr<INEvent>> EventsToRemoved;
-	for (const TSharedPtr<INEvent>& Event : Events)
+	// Packed events are advanced all at once, the sweep below only notifies them.
+	if (EventStore->Num() > 0)
+	{
+		EventStore->Advance(InDeltaTime, ExpiredBits, bParallelSweep ? ParallelSweepChunkSize : 0);
+	}
+	if (bParallelSweep)
 	{
-		Index++;
+		AdvanceRunningEventsInParallel(InDeltaTime, PreviousTime);
+	}
 
-		// This allow to manage manual expiration elsewhere using the INEvent::Stop() function
-		if (Event->IsExpired() && Event->GetStartedAt() >= 0.f)
+	// Only the top of the heap is checked, events which are not due yet are not visited.
+	DueEvents.Reset();
+	while (PendingEvents.Num() > 0)
+	{
+		const TSharedPtr<INEvent>& Event = Events[PendingEvents.HeapTop()].Event;
+		if (Event->GetDelay() > 0 && Event->GetDelay() > CurrentTime - Event->GetAttachedTime())
 		{
-			OnExpired(Event, CurrentTime, Index);
-			EventsToRemoved.Add(Event);
-			continue;
+			break;
 		}
+		int32 Slot;
+		PendingEvents.HeapPop(Slot, FNPendingEventPredicate(Events), false);
+		DueEvents.Add(Slot);
+	}
+	// Due events are merged with running ones to be notified in their attachment order.
+	DueEvents.Sort(
+		[this](const int32& SlotA, const int32& SlotB)
+		{
+			return Events[SlotA].Sequence < Events[SlotB].Sequence;
+		}
+	);
 
-		const float AttachedAt = Event->GetAttachedTime();
-		const float IntervalAttachedAt = CurrentTime - AttachedAt;
+	// Events attached by a listener during this loop are put after NumRunning and are not ticked.
+	const int32 NumRunning = RunningEvents.Num();
+	SweepBuffer.Reset(NumRunning + DueEvents.Num());
+	// Slots are freed only at the end of the sweep, so an Index can't be reused during a tick.
+	ExpiredSlots.Reset();
+	int32 DueIndex = 0;
+	int32 ExpiryIndex = 0;
 
-		if (Event->GetDelay() > 0 && Event->GetDelay() > IntervalAttachedAt)
+	for (int32 Idx = 0; Idx <= NumRunning; Idx++)
+	{
+		const int32 RunningSequence = Idx < NumRunning ? Events[RunningEvents[Idx]].Sequence : MAX_int32;
+		while (DueIndex < DueEvents.Num() && Events[DueEvents[DueIndex]].Sequence < RunningSequence)
 		{
-			continue;
+			const int32 Slot = DueEvents[DueIndex++];
+			SweepBuffer.Add(Slot);
+			StartEvent(Slot);
 		}
 
-		if (Event->GetStartedAt() < 0.f)
+		if (Idx == NumRunning)
 		{
-			StartEvent(Event, Index);
-			continue;
+			break;
 		}
 
+		const int32 Slot = RunningEvents[Idx];
+		bool bIsRunning;
+		if (bParallelSweep)
+		{
+			const bool bHasExpired = ExpiryIndex < SweepExpiries.Num() && SweepExpiries[ExpiryIndex].RunningIndex == Idx;
+			bIsRunning = NotifyRunningEvent(
+				Slot, bHasExpired ? SweepExpiries[ExpiryIndex++].Update : ENRunningEventUpdate::Running, PreviousTime
+			);
+		}
+		else
+		{
+			bIsRunning = TickRunningEvent(Slot, InDeltaTime, PreviousTime);
+		}
+		if (bIsRunning)
+		{
+			SweepBuffer.Add(Slot);
+		}
+		else
+		{
+			ExpiredSlots.Add(Slot);
+		}
+	}
+
+	for (int32 Idx = NumRunning; Idx < RunningEvents.Num(); Idx++)
+	{
+		SweepBuffer.Add(RunningEvents[Idx]);
+	}
+	Swap(RunningEvents, SweepBuffer);
+	SweepBuffer.Reset();
+
+	// Deferred notifications refer to the expired slots, they are released once the notifications are replayed.
+	if (!bDeferNotifications)
+	{
+		FinishTick();
+	}
+}
+
+void FNTimeline::FinishTick()
+{
+	ReleaseExpiredSlots();
+	ApplyExpiredEventsPolicy();
+
+	bIsTicking = false;
+	FlushNotifications();
+}
+
+void FNTimeline::ReleaseExpiredSlots()
+{
+	for (const int32& Slot : ExpiredSlots)
+	{
+		FNTimelineEventEntry& Entry = Events[Slot];
+		EventSlotsByUID.Remove(Entry.UID);
+		// Only an event nobody else references can be reused safely.
+		if (PoolCapacity > 0 && Pool.Num() < PoolCapacity && Entry.Event.IsUnique()
+			&& Entry.Event->Recycle(NAME_None, FGuid()))
+		{
+			Pool.Add(Entry.Event.ToSharedRef());
+			PoolStats.Recycled++;
+			// It never enters the history, listeners drop what they keep about it as for an evicted event.
+			BroadcastExpiredEventEvicted(Entry.UID);
+		}
+		else
+		{
+			const float ExpiredTime = Entry.Event->GetExpiredTime();
+			AddExpiredEvent(FNExpiredEventEntry(MoveTemp(Entry.Event), MoveTemp(Entry.UID), ExpiredTime));
+		}
+		Events.RemoveAt(Slot);
+	}
+}
+
+void FNTimeline::AdvanceBy(const float& InDelta, const FNTimelineAdvancePolicy& Policy)
+{
+	if (InDelta <= 0.f)
+	{
+		return;
+	}
+
+	const float Interval = Policy.Interval > 0.f ? Policy.Interval : (TickInterval > 0.f ? TickInterval : InDelta);
+	const float FromTime = CurrentTime;
+	const float ToTime = CurrentTime + InDelta;
+	const int32 NumTicks = FMath::Max(1, FMath::CeilToInt(InDelta / Interval - KINDA_SMALL_NUMBER));
+	// The last tick takes the remaining time.
+	auto GetTickTime = [FromTime, ToTime, Interval, NumTicks](const int32& InTick)
+	{
+		return InTick >= NumTicks ? ToTime : FromTime + InTick * Interval;
+	};
+	// The first tick, from InFirstTick, which reaches InTime. INDEX_NONE if it is after ToTime.
+	auto GetTickReaching = [FromTime, ToTime, Interval, NumTicks](const float& InTime, const int32& InFirstTick)
+	{
+		const int32 Tick = FMath::Max(
+			InFirstTick, FMath::CeilToInt((InTime - FromTime) / Interval - KINDA_SMALL_NUMBER)
+		);
+		if (Tick < NumTicks)
+		{
+			return Tick;
+		}
+		return InFirstTick <= NumTicks && InTime <= ToTime + KINDA_SMALL_NUMBER ? NumTicks : INDEX_NONE;
+	};
+
+	bIsTicking = true;
+	bIsTickObserved = EventChanged.IsBound()
+					  || EventsChanged[static_cast<int32>(ENTimelineEvent::Tick)].IsBound();
+
+	// Events which don't read the clock receive their elapsed time once, when they expire or at the end.
+	TMap<int32, float> SyncedTimes;
+	const int32 FirstNewSequence = NextSequence;
+	ExpiredSlots.Reset();
+	TArray<FNCatchUpChange> Changes;
+	TSet<int32> StartedSlots;
+	TSet<int32> StoppedSlots;
+	int32 Tick = 0;
+	bool bIsDone = false;
+
+	// Changes are computed from the current state up to ToTime. When a listener attaches an event,
+	// they are computed again from the tick it happens at.
+	while (!bIsDone)
+	{
+		const float TickTime = GetTickTime(Tick);
+		Changes.Reset();
+		for (const int32& Slot : RunningEvents)
+		{
+			const FNTimelineEventEntry& Entry = Events[Slot];
+			if (!SyncedTimes.Contains(Slot))
+			{
+				SyncedTimes.Add(Slot, Entry.Sequence > FirstNewSequence ? TickTime : FromTime);
+			}
+
+			const TSharedPtr<INEvent>& Event = Entry.Event;
+			if (Event->IsExpired() && Event->GetStartedAt() >= 0.f)
+			{
+				// Stopped with INEvent::Stop(), it expires at the next tick.
+				if (Tick < NumTicks)
+				{
+					Changes.Emplace(Tick + 1, Entry.Sequence, Slot, ENTimelineEvent::Expired, true);
+				}
+			}
+			else if (Event->GetDuration() > 0.f)
+			{
+				const float LocalTime = Event->GetLocalTime() + (Entry.bIsClockBound ? 0.f : TickTime - SyncedTimes[Slot]);
+				const int32 ExpiredTick = GetTickReaching(TickTime + Event->GetDuration() - LocalTime, Tick + 1);
+				if (ExpiredTick != INDEX_NONE)
+				{
+					Changes.Emplace(ExpiredTick, Entry.Sequence, Slot, ENTimelineEvent::Expired);
+				}
+			}
+		}
+
+		for (const int32& Slot : PendingEvents)
+		{
+			const FNTimelineEventEntry& Entry = Events[Slot];
+			const int32 StartTick = GetTickReaching(Entry.StartTime, Tick + 1);
+			if (StartTick == INDEX_NONE)
+			{
+				continue;
+			}
+			Changes.Emplace(StartTick, Entry.Sequence, Slot, ENTimelineEvent::Start);
+			const float Duration = Entry.Event->GetDuration();
+			if (Duration > 0.f)
+			{
+				const int32 ExpiredTick = GetTickReaching(GetTickTime(StartTick) + Duration, StartTick + 1);
+				if (ExpiredTick != INDEX_NONE)
+				{
+					Changes.Emplace(ExpiredTick, Entry.Sequence, Slot, ENTimelineEvent::Expired);
+				}
+			}
+		}
+		Changes.Sort();
+
+		const int32 SequenceBefore = NextSequence;
+		int32 RestartTick = INDEX_NONE;
+		for (const FNCatchUpChange& Change : Changes)
+		{
+			if (RestartTick != INDEX_NONE && Change.Tick > RestartTick)
+			{
+				break;
+			}
+			if (Change.Tick != Tick)
+			{
+				Tick = Change.Tick;
+				CurrentTime = GetTickTime(Tick);
+				Clock->Time = CurrentTime;
+			}
+
+			if (Change.EventName == ENTimelineEvent::Start)
+			{
+				StartedSlots.Add(Change.Slot);
+				RunningEvents.Add(Change.Slot);
+				SyncedTimes.Add(Change.Slot, CurrentTime);
+				StartEvent(Change.Slot);
+			}
+			else
+			{
+				// Copied because a listener which attaches a new event can reallocate Events.
+				const TSharedPtr<INEvent> Event = Events[Change.Slot].Event;
+				const bool bIsClockBound = Events[Change.Slot].bIsClockBound;
+				if (Change.bIsStopped)
+				{
+					if (bIsClockBound)
+					{
+						Event->UnbindClock(GetTickTime(Tick - 1));
+					}
+				}
+				else
+				{
+					if (!bIsClockBound)
+					{
+						Event->AddTime(CurrentTime - SyncedTimes[Change.Slot]);
+					}
+					Event->Stop();
+					if (bIsClockBound)
+					{
+						Event->UnbindClock(CurrentTime);
+					}
+				}
+				StoppedSlots.Add(Change.Slot);
+				ExpiredSlots.Add(Change.Slot);
+				OnExpired(Event, CurrentTime, Change.Slot);
+			}
+
+			if (RestartTick == INDEX_NONE && NextSequence != SequenceBefore)
+			{
+				RestartTick = Tick;
+			}
+		}
+
+		RunningEvents.RemoveAll(
+			[&StoppedSlots](const int32& Slot)
+			{
+				return StoppedSlots.Contains(Slot);
+			}
+		);
+		RunningEvents.Sort(
+			[this](const int32& SlotA, const int32& SlotB)
+			{
+				return Events[SlotA].Sequence < Events[SlotB].Sequence;
+			}
+		);
+		PendingEvents.RemoveAll(
+			[&StartedSlots](const int32& Slot)
+			{
+				return StartedSlots.Contains(Slot);
+			}
+		);
+		PendingEvents.Heapify(FNPendingEventPredicate(Events));
+		StartedSlots.Reset();
+		StoppedSlots.Reset();
+		bIsDone = RestartTick == INDEX_NONE;
+	}
+
+	CurrentTime = ToTime;
+	Clock->Time = CurrentTime;
+	for (const int32& Slot : RunningEvents)
+	{
+		const FNTimelineEventEntry& Entry = Events[Slot];
+		if (!Entry.bIsClockBound)
+		{
+			const float* SyncedTime = SyncedTimes.Find(Slot);
+			Entry.Event->AddTime(ToTime - (SyncedTime != nullptr ? *SyncedTime : FromTime));
+		}
+		if (Policy.bCoalesceTicks && bIsTickObserved && Entry.bNotifyTick)
+		{
+			Notify(Entry.Event, ENTimelineEvent::Tick, CurrentTime, Slot);
+		}
+	}
+
+	FinishTick();
+}
+
+int32 FNTimeline::AddEventEntry(const TSharedPtr<INEvent>& Event)
+{
+	FNTimelineEventEntry Entry(Event, ++NextSequence);
+	Entry.UID = Event->GetGUID();
+	int32 StoreIndex;
+	if (Event->GetStore(StoreIndex) == &EventStore.Get())
+	{
+		Entry.StoreIndex = StoreIndex;
+	}
+	const int32 Slot = Events.Add(Entry);
+	EventSlotsByUID.Add(MoveTemp(Entry.UID), Slot);
+	return Slot;
+}
+
+bool FNTimeline::TickRunningEvent(const int32& Slot, const float& InDeltaTime, const float& PreviousTime)
+{
+	if (Events[Slot].StoreIndex != INDEX_NONE)
+	{
+		return TickPackedEvent(Slot);
+	}
+
+	// Copied because a listener which attaches a new event can reallocate Events.
+	const TSharedPtr<INEvent> Event = Events[Slot].Event;
+	const bool bIsClockBound = Events[Slot].bIsClockBound;
+	const bool bNotifyTick = bIsTickObserved && Events[Slot].bNotifyTick;
+
+	// A clock bound event has already its new LocalTime,
+	// reaching its duration now is a regular expiration, not a manual one.
+	const bool bReachesDuration = bIsClockBound
+								  && Event->GetDuration() > 0
+								  && Event->GetLocalTime() >= Event->GetDuration();
+
+	// This allow to manage manual expiration elsewhere using the INEvent::Stop() function
+	if (!bReachesDuration && Event->IsExpired() && Event->GetStartedAt() >= 0.f)
+	{
+		if (bIsClockBound)
+		{
+			Event->UnbindClock(PreviousTime);
+		}
+		OnExpired(Event, CurrentTime, Slot);
+		return false;
+	}
+
+	if (!bIsClockBound)
+	{
 		Event->AddTime(InDeltaTime);
-		EventChanged.Broadcast(Event, ENTimelineEvent::Tick, CurrentTime, Index);
+	}
+	if (bNotifyTick)
+	{
+		Notify(Event, ENTimelineEvent::Tick, CurrentTime, Slot);
+	}
+
+	if (Event->IsExpired())
+	{
+		Event->Stop();
+		if (bIsClockBound)
+		{
+			Event->UnbindClock(CurrentTime);
+		}
+		OnExpired(Event, CurrentTime, Slot);
+		return false;
+	}
+
+	return true;
+}
+
+ENRunningEventUpdate FNTimeline::AdvanceRunningEvent(const int32& Slot, const float& InDeltaTime,
+	const float& PreviousTime)
+{
+	const FNTimelineEventEntry& Entry = Events[Slot];
+	if (Entry.StoreIndex != INDEX_NONE)
+	{
+		const int32 Index = Entry.StoreIndex;
+		FNEventStore& Store = EventStore.Get();
+		if ((Store.Flags[Index] & FNEventStore::Activated) == 0
+			|| (Store.Durations[Index] > 0 && Store.PreviousLocalTimes[Index] >= Store.Durations[Index]))
+		{
+			Store.LocalTimes[Index] = Store.PreviousLocalTimes[Index];
+			Store.Steps[Index] = 0.f;
+			return ENRunningEventUpdate::Stopped;
+		}
+		if ((ExpiredBits[Index >> 5] & (1u << (Index & 31))) != 0)
+		{
+			Store.Flags[Index] &= ~FNEventStore::Activated;
+			Store.Steps[Index] = 0.f;
+			return ENRunningEventUpdate::Expired;
+		}
+		return ENRunningEventUpdate::Running;
+	}
+
+	// A raw pointer, the ref count of a shared pointer is not thread safe.
+	INEvent* Event = Entry.Event.Get();
+	const bool bReachesDuration = Entry.bIsClockBound
+								  && Event->GetDuration() > 0
+								  && Event->GetLocalTime() >= Event->GetDuration();
+	// Clocks are unbound by NotifyRunningEvent(), the clock is shared by every events.
+	if (!bReachesDuration && Event->IsExpired() && Event->GetStartedAt() >= 0.f)
+	{
+		return ENRunningEventUpdate::Stopped;
+	}
+
+	if (!Entry.bIsClockBound)
+	{
+		Event->AddTime(InDeltaTime);
+	}
+	if (Event->IsExpired())
+	{
+		Event->Stop();
+		return ENRunningEventUpdate::Expired;
+	}
+	return ENRunningEventUpdate::Running;
+}
+
+void FNTimeline::AdvanceRunningEventsInParallel(const float& InDeltaTime, const float& PreviousTime)
+{
+	const int32 NumChunks = FMath::DivideAndRoundUp(RunningEvents.Num(), ParallelSweepChunkSize);
+	TArray<TArray<FNSweepExpiry>> ChunkExpiries;
+	ChunkExpiries.SetNum(NumChunks);
+	ParallelFor(
+		NumChunks, [this, &ChunkExpiries, &InDeltaTime, &PreviousTime](int32 Chunk)
+		{
+			TArray<FNSweepExpiry>& Expiries = ChunkExpiries[Chunk];
+			const int32 End = FMath::Min((Chunk + 1) * ParallelSweepChunkSize, RunningEvents.Num());
+			for (int32 Idx = Chunk * ParallelSweepChunkSize; Idx < End; Idx++)
+			{
+				const ENRunningEventUpdate Update = AdvanceRunningEvent(RunningEvents[Idx], InDeltaTime, PreviousTime);
+				if (Update != ENRunningEventUpdate::Running)
+				{
+					Expiries.Emplace(Idx, Update);
+				}
+			}
+		}
+	);
+
+	// Chunks are in RunningEvents order, so are their expiries.
+	SweepExpiries.Reset();
+	for (const TArray<FNSweepExpiry>& Expiries : ChunkExpiries)
+	{
+		SweepExpiries.Append(Expiries);
+	}
+}
+
+bool FNTimeline::NotifyRunningEvent(const int32& Slot, const ENRunningEventUpdate& Update, const float& PreviousTime)
+{
+	if (Update != ENRunningEventUpdate::Stopped && bIsTickObserved && Events[Slot].bNotifyTick)
+	{
+		Notify(Events[Slot].Event, ENTimelineEvent::Tick, CurrentTime, Slot);
+	}
+	if (Update == ENRunningEventUpdate::Running)
+	{
+		return true;
+	}
+	if (Events[Slot].bIsClockBound)
+	{
+		Events[Slot].Event->UnbindClock(Update == ENRunningEventUpdate::Stopped ? PreviousTime : CurrentTime);
+	}
+	OnExpired(Events[Slot].Event, CurrentTime, Slot);
+	return false;
+}
+
+bool FNTimeline::TickPackedEvent(const int32& Slot)
+{
+	const int32 Index = Events[Slot].StoreIndex;
+	FNEventStore& Store = EventStore.Get();
+
+	// This allow to manage manual expiration elsewhere using the INEvent::Stop() function.
+	// The event may have been stopped by a listener after Advance(), so its LocalTime is restored.
+	if ((Store.Flags[Index] & FNEventStore::Activated) == 0
+		|| (Store.Durations[Index] > 0 && Store.PreviousLocalTimes[Index] >= Store.Durations[Index]))
+	{
+		Store.LocalTimes[Index] = Store.PreviousLocalTimes[Index];
+		Store.Steps[Index] = 0.f;
+		OnExpired(Events[Slot].Event, CurrentTime, Slot);
+		return false;
+	}
+
+	if (bIsTickObserved && Events[Slot].bNotifyTick)
+	{
+		Notify(Events[Slot].Event, ENTimelineEvent::Tick, CurrentTime, Slot);
+	}
+
+	// Without listener nothing can change the event since Advance(), its result can be used as is.
+	const bool bIsExpired = EventChanged.IsBound()
+								? Store.IsExpired(Index)
+								: (ExpiredBits[Index >> 5] & (1u << (Index & 31))) != 0;
+	if (bIsExpired)
+	{
+		Store.Flags[Index] &= ~FNEventStore::Activated;
+		Store.Steps[Index] = 0.f;
+		OnExpired(Events[Slot].Event, CurrentTime, Slot);
+		return false;
+	}
+
+	return true;
+}
 
-		if (Event->IsExpired())
+void FNTimeline::ResetSchedule()
+{
+	for (const int32& Slot : RunningEvents)
+	{
+		if (Events[Slot].bIsClockBound)
+		{
+			Events[Slot].Event->UnbindClock(CurrentTime);
+		}
+		if (Events[Slot].StoreIndex != INDEX_NONE)
 		{
-			Event->Stop();
-			OnExpired(Event, CurrentTime, Index);
-			EventsToRemoved.Add(Event);
+			EventStore->Steps[Events[Slot].StoreIndex] = 0.f;
 		}
 	}
+	RunningEvents.Empty();
+	PendingEvents.Empty();
+	SweepBuffer.Empty();
+	DueEvents.Empty();
+	ExpiredSlots.Empty();
+	NextSequence = 0;
+}
 
-	for (TSharedPtr<INEvent> EventToRemoved : EventsToRemoved)
+void FNTimeline::RestoreEvents(const TArray<TSharedPtr<INEvent>>& InEvents)
+{
+	ResetSchedule();
+	Events.Empty(InEvents.Num());
+	EventSlotsByUID.Empty(InEvents.Num());
+	for (const TSharedPtr<INEvent>& Event : InEvents)
 	{
-		ExpiredEvents.Add(EventToRemoved);
-		Events.Remove(EventToRemoved);
+		const int32 Slot = AddEventEntry(Event);
+		if (Event->GetStartedAt() < 0.f)
+		{
+			Events[Slot].StartTime = Event->GetAttachedTime() + Event->GetDelay();
+			ScheduleEvent(Slot);
+			continue;
+		}
+		Events[Slot].bIsClockBound = Event->BindClock(Clock);
+		if (Events[Slot].StoreIndex != INDEX_NONE && !Event->IsExpired())
+		{
+			EventStore->Steps[Events[Slot].StoreIndex] = 1.f;
+		}
+		RunningEvents.Add(Slot);
 	}
-	EventsToRemoved.Empty();
 }
 
-void FNTimeline::OnExpired(const TSharedPtr<INEvent>& Event, const float& ExpiredTime, const int32& Index) const
+void FNTimeline::OnExpired(const TSharedPtr<INEvent>& Event, const float& ExpiredTime, const int32& Index)
 {
 	Event->SetExpiredTime(ExpiredTime);
-	EventChanged.Broadcast(Event, ENTimelineEvent::Expired, ExpiredTime, Index);
+	Notify(Event, ENTimelineEvent::Expired, ExpiredTime, Index);
+}
+
+void FNTimeline::Notify(const TSharedPtr<INEvent>& Event, const ENTimelineEvent& EventName, const float& Time,
+	const int32& Index)
+{
+	if (!bDeferNotifications)
+	{
+		EventChanged.Broadcast(Event, EventName, Time, Index);
+	}
+	else if (EventChanged.IsBound())
+	{
+		DeferredNotifications.Emplace(Event, EventName, Time, Index);
+	}
+
+	const int32 Type = static_cast<int32>(EventName);
+	if (EventsChanged[Type].IsBound())
+	{
+		PendingNotifications[Type].Emplace(Event, EventName, Time, Index);
+	}
+}
+
+void FNTimeline::AddExpiredEvent(FNExpiredEventEntry&& Entry)
+{
+	// The history is never ticked, a packed event frees its store index so Advance() doesn't sweep it.
+	if (Entry.Event.IsValid())
+	{
+		Entry.Event->ReleaseStore();
+	}
+	if (ExpiredEventsPolicy.Retention == ENExpiredEventsRetention::None)
+	{
+		OnExpiredEventEvicted(Entry);
+		return;
+	}
+
+	ExpiredEventIndexesByUID.Add(Entry.UID, NumEvictedEvents + ExpiredEvents.Num());
+	ExpiredEvents.Add(MoveTemp(Entry));
+	if (ExpiredEventsPolicy.Retention == ENExpiredEventsRetention::Last
+		&& ExpiredEvents.Num() > ExpiredEventsPolicy.MaxEvents)
+	{
+		EvictExpiredEvent();
+	}
+}
+
+void FNTimeline::ApplyExpiredEventsPolicy()
+{
+	switch (ExpiredEventsPolicy.Retention)
+	{
+		case ENExpiredEventsRetention::Last:
+			while (ExpiredEvents.Num() > FMath::Max(0, ExpiredEventsPolicy.MaxEvents))
+			{
+				EvictExpiredEvent();
+			}
+			break;
+		case ENExpiredEventsRetention::Lifespan:
+			// Events are added in their expiration order, so only the oldest ones are checked.
+			while (ExpiredEvents.Num() > 0
+				   && CurrentTime - ResolveExpiredEntry(0).ExpiredTime > ExpiredEventsPolicy.Lifespan)
+			{
+				EvictExpiredEvent();
+			}
+			break;
+		case ENExpiredEventsRetention::None:
+			while (ExpiredEvents.Num() > 0)
+			{
+				EvictExpiredEvent();
+			}
+			break;
+		default:
+			break;
+	}
+}
+
+void FNTimeline::EvictExpiredEvent()
+{
+	if (ExpiredEventsPolicy.bSummarize)
+	{
+		ResolveExpiredEntry(0);
+	}
+	const FNExpiredEventEntry Entry = ExpiredEvents.PopFirst();
+	NumEvictedEvents++;
+	ExpiredEventIndexesByUID.Remove(Entry.UID);
+	OnExpiredEventEvicted(Entry);
+}
+
+void FNTimeline::OnExpiredEventEvicted(const FNExpiredEventEntry& Entry)
+{
+	if (ExpiredEventsPolicy.bSummarize)
+	{
+		if (ExpiredEventsSummary.Num == 0)
+		{
+			ExpiredEventsSummary.FirstExpiredTime = Entry.ExpiredTime;
+		}
+		ExpiredEventsSummary.Num++;
+		ExpiredEventsSummary.LastExpiredTime = Entry.ExpiredTime;
+		ExpiredEventsSummary.TotalLocalTime += Entry.Event->GetLocalTime();
+	}
+	BroadcastExpiredEventEvicted(Entry.UID);
+}
+
+void FNTimeline::BroadcastExpiredEventEvicted(const FGuid& UID)
+{
+	if (bDeferNotifications)
+	{
+		DeferredEvictions.Add(UID);
+		return;
+	}
+	ExpiredEventEvicted.Broadcast(UID);
+}
+
+void FNTimeline::ReplayDeferredNotifications()
+{
+	bDeferNotifications = false;
+	// As in NotifyTick(), an event attached by a listener doesn't flush the batches before the end.
+	bIsTicking = true;
+	for (const FNTimelineNotification& Notification : DeferredNotifications)
+	{
+		EventChanged.Broadcast(Notification.Event, Notification.EventName, Notification.Time, Notification.Index);
+	}
+	DeferredNotifications.Reset();
+	for (const FGuid& UID : DeferredEvictions)
+	{
+		ExpiredEventEvicted.Broadcast(UID);
+	}
+	DeferredEvictions.Reset();
+	// Listeners have released what they hold on expired events, so they can be pooled.
+	FinishTick();
+}
+
+void FNTimeline::FlushNotifications()
+{
+	if (bDeferNotifications) return;
+
+	for (int32 Type = 0; Type < NumEventNames; Type++)
+	{
+		if (PendingNotifications[Type].Num() == 0) continue;
+
+		// Moved out, a listener can attach an event and queue new notifications during the broadcast.
+		TArray<FNTimelineNotification> Batch = MoveTemp(PendingNotifications[Type]);
+		EventsChanged[Type].Broadcast(Batch);
+		if (PendingNotifications[Type].Num() == 0)
+		{
+			// Gives the allocation back for the next tick
+			Batch.Reset();
+			PendingNotifications[Type] = MoveTemp(Batch);
+		}
+		else
+		{
+			FlushNotifications();
+		}
+	}
 }
 
 float FNTimeline::GetTickInterval() const
@@ -141,6 +913,7 @@ void FNTimeline::SetTickInterval(const float& InTickInterval)
 void FNTimeline::SetCurrentTime(const float& InCurrentTime)
 {
 	CurrentTime = InCurrentTime;
+	Clock->Time = CurrentTime;
 }
 
 float FNTimeline::GetCurrentTime() const
@@ -148,6 +921,21 @@ float FNTimeline::GetCurrentTime() const
 	return CurrentTime;
 }
 
+bool FNTimeline::IsCatchingUp() const
+{
+	return CatchUpRemainingTime > 0.f;
+}
+
+float FNTimeline::GetCatchUpProgress() const
+{
+	return CatchUpTime > 0.f ? 1.f - CatchUpRemainingTime / CatchUpTime : 1.f;
+}
+
+float FNTimeline::GetCatchUpRemainingTime() const
+{
+	return CatchUpRemainingTime;
+}
+
 void FNTimeline::SetLabel(const FName& InLabel)
 {
 	Label = InLabel;
@@ -158,80 +946,454 @@ FName FNTimeline::GetLabel() const
 	return Label;
 }
 
+bool FNTimeline::SetStorage(const ENTimelineStorage& InStorage)
+{
+	if (Events.Num() > 0 || ExpiredEvents.Num() > 0)
+	{
+		return InStorage == Storage;
+	}
+	if (InStorage != Storage)
+	{
+		// Pooled events use the previous storage
+		Pool.Empty();
+	}
+	Storage = InStorage;
+	return true;
+}
+
+ENTimelineStorage FNTimeline::GetStorage() const
+{
+	return Storage;
+}
+
+TSharedRef<INEvent> FNTimeline::CreateEvent(const FName& InLabel, const FGuid& InUId)
+{
+	if (PoolCapacity > 0)
+	{
+		if (Pool.Num() > 0)
+		{
+			TSharedRef<INEvent> Event = Pool.Pop(false);
+			Event->Recycle(InLabel, InUId);
+			PoolStats.Hits++;
+			return Event;
+		}
+		PoolStats.Misses++;
+	}
+
+	if (Storage == ENTimelineStorage::Packed)
+	{
+		return MakeShared<FNPackedEvent>(EventStore, InLabel, InUId);
+	}
+	return MakeShared<FNTimelineEvent>(InLabel, InUId);
+}
+
+void FNTimeline::SetPoolCapacity(const int32& InCapacity)
+{
+	PoolCapacity = FMath::Max(0, InCapacity);
+	if (Pool.Num() > PoolCapacity)
+	{
+		Pool.SetNum(PoolCapacity);
+	}
+}
+
+void FNTimeline::SetParallelSweepThreshold(const int32& InThreshold)
+{
+	ParallelSweepThreshold = FMath::Max(0, InThreshold);
+}
+
+int32 FNTimeline::GetParallelSweepThreshold() const
+{
+	return ParallelSweepThreshold;
+}
+
+FNEventPoolStats FNTimeline::GetPoolStats() const
+{
+	FNEventPoolStats Stats = PoolStats;
+	Stats.Pooled = Pool.Num();
+	return Stats;
+}
+
+void FNTimeline::SetExpiredEventsPolicy(const FNExpiredEventsPolicy& InPolicy)
+{
+	ExpiredEventsPolicy = InPolicy;
+	ApplyExpiredEventsPolicy();
+}
+
+void FNTimeline::SetArchivePackedTimes(const bool& bInPackedTimes)
+{
+	bArchivePackedTimes = bInPackedTimes;
+}
+
+FNExpiredEventsPolicy FNTimeline::GetExpiredEventsPolicy() const
+{
+	return ExpiredEventsPolicy;
+}
+
+FNExpiredEventsSummary FNTimeline::GetExpiredEventsSummary() const
+{
+	return ExpiredEventsSummary;
+}
+
 void FNTimeline::Clear()
 {
+	ResetSchedule();
 	Events.Empty();
 	ExpiredEvents.Empty();
+	ExpiredRecords.Reset();
+	NumEvictedEvents = 0;
+	ExpiredEventsSummary = FNExpiredEventsSummary();
+	EventSlotsByUID.Empty();
+	ExpiredEventIndexesByUID.Empty();
+	for (TArray<FNTimelineNotification>& Notifications : PendingNotifications)
+	{
+		Notifications.Reset();
+	}
+	CatchUpTime = 0.f;
+	CatchUpRemainingTime = 0.f;
 	CurrentTime = 0;
+	Clock->Time = CurrentTime;
 }
 
 TSharedPtr<INEvent> FNTimeline::GetEvent(const FString& InUID) const
 {
-	const TSharedPtr<INEvent>* EventPtr = Events.FindByKey(InUID);
-	if (EventPtr == nullptr) return nullptr;
-	TSharedPtr<INEvent> Event = *EventPtr;
-	return Event;
+	FGuid Id;
+	if (!FGuid::Parse(InUID, Id)) return nullptr;
+	return GetEvent(Id);
+}
+
+TSharedPtr<INEvent> FNTimeline::GetEvent(const FGuid& InUID) const
+{
+	const int32* Slot = EventSlotsByUID.Find(InUID);
+	if (Slot == nullptr) return nullptr;
+	return Events[*Slot].Event;
+}
+
+bool FNTimeline::SetTickNotified(const FGuid& InUID, const bool& bInNotified)
+{
+	const int32* Slot = EventSlotsByUID.Find(InUID);
+	if (Slot == nullptr) return false;
+	Events[*Slot].bNotifyTick = bInNotified;
+	return true;
+}
+
+TSharedPtr<INEvent> FNTimeline::GetEventAt(const int32& Index) const
+{
+	if (!Events.IsValidIndex(Index)) return nullptr;
+	return Events[Index].Event;
 }
 
 TSharedPtr<INEvent> FNTimeline::GetExpiredEvent(const FString& InUID) const
 {
-	const TSharedPtr<INEvent>* EventPtr = ExpiredEvents.FindByKey(InUID);
-	if (EventPtr == nullptr) return nullptr;
-	TSharedPtr<INEvent> Event = *EventPtr;
-	return Event;
+	FGuid Id;
+	if (!FGuid::Parse(InUID, Id)) return nullptr;
+	return GetExpiredEvent(Id);
+}
+
+TSharedPtr<INEvent> FNTimeline::GetExpiredEvent(const FGuid& InUID) const
+{
+	const int32* Position = ExpiredEventIndexesByUID.Find(InUID);
+	if (Position == nullptr) return nullptr;
+	return ResolveExpiredEntry(*Position - NumEvictedEvents).Event;
+}
+
+bool FNTimeline::IsExpiredEventResolved(const FGuid& InUID) const
+{
+	const int32* Position = ExpiredEventIndexesByUID.Find(InUID);
+	return Position != nullptr && ExpiredEvents[*Position - NumEvictedEvents].Event.IsValid();
 }
 
 TArray<TSharedPtr<INEvent>> FNTimeline::GetEvents() const
 {
-	return Events;
+	// Slots are reused, sort them back to the attachment order.
+	TArray<const FNTimelineEventEntry*> Entries;
+	Entries.Reserve(Events.Num());
+	for (const FNTimelineEventEntry& Entry : Events)
+	{
+		Entries.Add(&Entry);
+	}
+	Entries.Sort(
+		[](const FNTimelineEventEntry& A, const FNTimelineEventEntry& B)
+		{
+			return A.Sequence < B.Sequence;
+		}
+	);
+
+	TArray<TSharedPtr<INEvent>> EventsList;
+	EventsList.Reserve(Entries.Num());
+	for (const FNTimelineEventEntry* Entry : Entries)
+	{
+		EventsList.Add(Entry->Event);
+	}
+	return EventsList;
+}
+
+const FNExpiredEventEntry& FNTimeline::ResolveExpiredEntry(const int32& Index) const
+{
+	const FNExpiredEventEntry& Entry = ExpiredEvents[Index];
+	if (!Entry.Event.IsValid() && Entry.RecordOffset != INDEX_NONE && ExpiredRecords.IsValid())
+	{
+		FMemoryReader Reader(ExpiredRecords->Data);
+		Reader.Seek(Entry.RecordOffset);
+		FNTimelineArchive RecordsAr(Reader, ExpiredRecords->Names, ExpiredRecords->bPackedTimes, ExpiredRecords->Version);
+		// An expired event is never ticked again, so it doesn't need the timeline storage.
+		TSharedRef<INEvent> Event = MakeShared<FNTimelineEvent>(NAME_None, Entry.UID);
+		Event->ArchiveRecord(RecordsAr);
+		Entry.ExpiredTime = Event->GetExpiredTime();
+		Entry.Event = Event;
+	}
+	return Entry;
 }
 
 TArray<TSharedPtr<INEvent>> FNTimeline::GetExpiredEvents() const
 {
-	return ExpiredEvents;
+	TArray<TSharedPtr<INEvent>> EventsList;
+	EventsList.Reserve(ExpiredEvents.Num());
+	for (int32 Idx = 0; Idx < ExpiredEvents.Num(); Idx++)
+	{
+		EventsList.Add(ResolveExpiredEntry(Idx).Event);
+	}
+	return EventsList;
 }
 
-void FNTimeline::Archive(FArchive& Ar)
+void FNTimeline::Archive(FArchive& Ar, const ENTimelineArchiveVersion& SaveVersion)
 {
 	if (Ar.IsLoading())
 	{
 		Clear();
 	}
 
+	int32 Version = static_cast<int32>(SaveVersion);
+	if (Ar.IsLoading())
+	{
+		uint32 Magic = 0;
+		const int64 StartPosition = Ar.Tell();
+		Ar << Magic;
+		if (Magic == FNTimelineArchive::Magic)
+		{
+			Ar << Version;
+		}
+		else
+		{
+			// Legacy saves have no header, they start with the timeline label.
+			Ar.Seek(StartPosition);
+			Version = static_cast<int32>(ENTimelineArchiveVersion::Legacy);
+		}
+	}
+	else if (SaveVersion != ENTimelineArchiveVersion::Legacy)
+	{
+		uint32 Magic = FNTimelineArchive::Magic;
+		Ar << Magic;
+		Ar << Version;
+	}
+
+	if (Version > static_cast<int32>(ENTimelineArchiveVersion::Latest))
+	{
+		Ar.SetError();
+		return;
+	}
+	// Decorators read it to load their own data in the same format.
+	Ar.SetCustomVersion(FNTimelineArchive::VersionGUID, Version, TEXT("NansTimelineArchive"));
+
+	if (Version == static_cast<int32>(ENTimelineArchiveVersion::Legacy))
+	{
+		ArchiveLegacy(Ar);
+	}
+	else
+	{
+		ArchiveCompact(Ar, Version);
+	}
+}
+
+void FNTimeline::ArchiveCompact(FArchive& Ar, const int32& Version)
+{
 	Ar << Label;
-	Ar << CurrentTime;
+	if (Version >= static_cast<int32>(ENTimelineArchiveVersion::DoubleClockTime))
+	{
+		Ar << Clock->Time;
+		CurrentTime = static_cast<float>(Clock->Time);
+	}
+	else
+	{
+		Ar << CurrentTime;
+		Clock->Time = CurrentTime;
+	}
 	Ar << TickInterval;
 
-	int32 NumEvents = Events.Num();
-	int32 NumExpiredEvents = ExpiredEvents.Num();
+	bool bPackedTimes = bArchivePackedTimes;
+	Ar << bPackedTimes;
+
+	TArray<TSharedPtr<INEvent>> LiveEvents;
+	TArray<TSharedPtr<INEvent>> Expired;
+	if (Ar.IsSaving())
+	{
+		LiveEvents = GetEvents();
+		Expired = GetExpiredEvents();
+	}
 
+	int32 NumEvents = LiveEvents.Num();
+	int32 NumExpiredEvents = Expired.Num();
 	Ar << NumEvents;
 	Ar << NumExpiredEvents;
 
+	Ar << ExpiredEventsSummary.Num;
+	Ar << ExpiredEventsSummary.FirstExpiredTime;
+	Ar << ExpiredEventsSummary.LastExpiredTime;
+	Ar << ExpiredEventsSummary.TotalLocalTime;
+
+	// Records are written first in their own buffer to know the labels table which has to be loaded before them.
+	const bool bIsIndexed = Version >= static_cast<int32>(ENTimelineArchiveVersion::IndexedExpiredEvents);
+	TArray<FName> Names;
+	TArray<uint8> Records;
+	TArray<int32> ExpiredOffsets;
+	if (Ar.IsSaving())
+	{
+		Records.Reserve((NumEvents + NumExpiredEvents) * 32);
+		FMemoryWriter Writer(Records);
+		FNTimelineArchive RecordsAr(Writer, Names, bPackedTimes, Version);
+		for (const TSharedPtr<INEvent>& Event : LiveEvents)
+		{
+			Event->ArchiveRecord(RecordsAr);
+		}
+		if (bIsIndexed)
+		{
+			ExpiredOffsets.Reserve(NumExpiredEvents);
+		}
+		for (const TSharedPtr<INEvent>& Event : Expired)
+		{
+			if (bIsIndexed)
+			{
+				ExpiredOffsets.Add(static_cast<int32>(Writer.Tell()));
+				RecordsAr.ResetDeltas();
+			}
+			Event->ArchiveRecord(RecordsAr);
+		}
+	}
+
+	Ar << Names;
+	Ar << Records;
+	if (bIsIndexed)
+	{
+		Ar << ExpiredOffsets;
+	}
+
 	if (Ar.IsLoading())
 	{
-		Events.Reserve(NumEvents);
+		FMemoryReader Reader(Records);
+		FNTimelineArchive RecordsAr(Reader, Names, bPackedTimes, Version);
+		LiveEvents.Reserve(NumEvents);
 		for (int32 Idx = 0; Idx < NumEvents; Idx++)
 		{
-			Events.Add(MakeShared<FNEvent>());
+			LiveEvents.Add(CreateEvent(NAME_None));
+			LiveEvents.Last()->ArchiveRecord(RecordsAr);
 		}
 
+		// The policy is applied at the next tick, so a decorator can restore all the loaded events first.
 		ExpiredEvents.Reserve(NumExpiredEvents);
+		ExpiredEventIndexesByUID.Reserve(NumExpiredEvents);
+		if (bIsIndexed && ExpiredOffsets.Num() == NumExpiredEvents)
+		{
+			// A record starts with its UID, nothing else is read until the event is accessed.
+			for (int32 Idx = 0; Idx < NumExpiredEvents; Idx++)
+			{
+				FGuid UID;
+				Reader.Seek(ExpiredOffsets[Idx]);
+				Reader << UID;
+				ExpiredEventIndexesByUID.Add(UID, Idx);
+				ExpiredEvents.Add(FNExpiredEventEntry(MoveTemp(UID), ExpiredOffsets[Idx]));
+			}
+		}
+		else
+		{
+			for (int32 Idx = 0; Idx < NumExpiredEvents; Idx++)
+			{
+				TSharedPtr<INEvent> Event = CreateEvent(NAME_None);
+				Event->ArchiveRecord(RecordsAr);
+				Event->ReleaseStore();
+				FGuid UID = Event->GetGUID();
+				const float ExpiredTime = Event->GetExpiredTime();
+				ExpiredEventIndexesByUID.Add(UID, Idx);
+				ExpiredEvents.Add(FNExpiredEventEntry(MoveTemp(Event), MoveTemp(UID), ExpiredTime));
+			}
+		}
+
+		if (RecordsAr.IsError() || Reader.IsError())
+		{
+			Ar.SetError();
+		}
+		RestoreEvents(LiveEvents);
+
+		if (bIsIndexed && NumExpiredEvents > 0)
+		{
+			ExpiredRecords = MakeShared<FNEventRecords>();
+			ExpiredRecords->Data = MoveTemp(Records);
+			ExpiredRecords->Names = MoveTemp(Names);
+			ExpiredRecords->bPackedTimes = bPackedTimes;
+			ExpiredRecords->Version = Version;
+		}
+	}
+}
+
+void FNTimeline::ArchiveLegacy(FArchive& Ar)
+{
+	Ar << Label;
+	Ar << CurrentTime;
+	Ar << TickInterval;
+	Clock->Time = CurrentTime;
+
+	TArray<TSharedPtr<INEvent>> LiveEvents;
+	TArray<TSharedPtr<INEvent>> Expired;
+	if (Ar.IsSaving())
+	{
+		LiveEvents = GetEvents();
+		Expired = GetExpiredEvents();
+	}
+
+	int32 NumEvents = LiveEvents.Num();
+	int32 NumExpiredEvents = Expired.Num();
+
+	Ar << NumEvents;
+	Ar << NumExpiredEvents;
+
+	if (Ar.IsLoading())
+	{
+		LiveEvents.Reserve(NumEvents);
+		for (int32 Idx = 0; Idx < NumEvents; Idx++)
+		{
+			LiveEvents.Add(CreateEvent(NAME_None));
+		}
+
+		Expired.Reserve(NumExpiredEvents);
 		for (int32 Idx = 0; Idx < NumExpiredEvents; Idx++)
 		{
-			ExpiredEvents.Add(MakeShared<FNEvent>());
+			Expired.Add(CreateEvent(NAME_None));
 		}
 	}
 
 	for (int32 Idx = 0; Idx < NumEvents; Idx++)
 	{
-		TSharedPtr<INEvent> Event = Events[Idx];
+		TSharedPtr<INEvent> Event = LiveEvents[Idx];
 		Event->Archive(Ar);
 	}
 
 	for (int32 Idx = 0; Idx < NumExpiredEvents; Idx++)
 	{
-		TSharedPtr<INEvent> Event = ExpiredEvents[Idx];
+		TSharedPtr<INEvent> Event = Expired[Idx];
 		Event->Archive(Ar);
 	}
+
+	if (Ar.IsLoading())
+	{
+		// The policy is applied at the next tick, so a decorator can restore all the loaded events first.
+		ExpiredEvents.Reserve(NumExpiredEvents);
+		ExpiredEventIndexesByUID.Reserve(NumExpiredEvents);
+		for (int32 Idx = 0; Idx < NumExpiredEvents; Idx++)
+		{
+			Expired[Idx]->ReleaseStore();
+			FGuid UID = Expired[Idx]->GetGUID();
+			const float ExpiredTime = Expired[Idx]->GetExpiredTime();
+			ExpiredEventIndexesByUID.Add(UID, Idx);
+			ExpiredEvents.Add(FNExpiredEventEntry(MoveTemp(Expired[Idx]), MoveTemp(UID), ExpiredTime));
+		}
+		RestoreEvents(LiveEvents);
+	}
 }
@@ -0,0 +1,158 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "TimelineArchive.h"
+
+#include "Serialization/CustomVersion.h"
+
+const FGuid FNTimelineArchive::VersionGUID(0x7C4A3B21, 0x5E9D4F60, 0xA1B2C3D4, 0x4E54494D);
+const uint32 FNTimelineArchive::Magic = 0x4E544C4E;
+
+static FCustomVersionRegistration GRegisterNansTimelineArchiveVersion(
+	FNTimelineArchive::VersionGUID, static_cast<int32>(ENTimelineArchiveVersion::Latest), TEXT("NansTimelineArchive")
+);
+
+FNTimelineArchive::FNTimelineArchive(FArchive& InInnerArchive, TArray<FName>& InNames, const bool& bInPackedTimes,
+	const int32& InVersion)
+	: FArchiveProxy(InInnerArchive), Names(InNames), bPackedTimes(bInPackedTimes), Version(InVersion)
+{
+	// Only needed to write names, a loading archive can be created for a single record.
+	if (IsSaving())
+	{
+		for (int32 Idx = 0; Idx < Names.Num(); Idx++)
+		{
+			NameIndexes.Add(Names[Idx], Idx);
+		}
+	}
+}
+
+FArchive& FNTimelineArchive::operator<<(FName& Value)
+{
+	int32 Index = 0;
+	if (IsSaving())
+	{
+		const int32* Found = NameIndexes.Find(Value);
+		Index = Found != nullptr ? *Found : NameIndexes.Add(Value, Names.Add(Value));
+	}
+	uint32 PackedIndex = static_cast<uint32>(Index);
+	InnerArchive.SerializeIntPacked(PackedIndex);
+	if (IsLoading())
+	{
+		Index = static_cast<int32>(PackedIndex);
+		if (Names.IsValidIndex(Index))
+		{
+			Value = Names[Index];
+		}
+		else
+		{
+			SetError();
+			Value = NAME_None;
+		}
+	}
+	return *this;
+}
+
+FString FNTimelineArchive::GetArchiveName() const
+{
+	return TEXT("FNTimelineArchive");
+}
+
+void FNTimelineArchive::SerializeTime(float& Time)
+{
+	if (!bPackedTimes)
+	{
+		InnerArchive << Time;
+		return;
+	}
+
+	int64 Milliseconds = IsSaving() ? ToMilliseconds(Time) : 0;
+	SerializePackedInt(Milliseconds);
+	if (IsLoading())
+	{
+		Time = static_cast<float>(Milliseconds / 1000.0);
+	}
+}
+
+void FNTimelineArchive::SerializeAttachedTime(float& Time)
+{
+	if (!bPackedTimes)
+	{
+		InnerArchive << Time;
+		return;
+	}
+
+	// Records are sorted by attachment, the delta is small and positive most of the time.
+	const int64 Milliseconds = IsSaving() ? ToMilliseconds(Time) : 0;
+	int64 Delta = Milliseconds - PreviousAttachedTime;
+	SerializePackedInt(Delta);
+	PreviousAttachedTime += Delta;
+	if (IsLoading())
+	{
+		Time = static_cast<float>(PreviousAttachedTime / 1000.0);
+	}
+}
+
+void FNTimelineArchive::ResetDeltas()
+{
+	PreviousAttachedTime = 0;
+}
+
+int64 FNTimelineArchive::ToMilliseconds(const float& Time)
+{
+	return static_cast<int64>(FMath::RoundToDouble(static_cast<double>(Time) * 1000.0));
+}
+
+void FNTimelineArchive::SerializePackedInt(int64& Value)
+{
+	if (Version < static_cast<int32>(ENTimelineArchiveVersion::PackedTimes64))
+	{
+		const int32 Value32 = static_cast<int32>(FMath::Clamp<int64>(Value, MIN_int32, MAX_int32));
+		uint32 ZigZag = (static_cast<uint32>(Value32) << 1) ^ static_cast<uint32>(Value32 >> 31);
+		InnerArchive.SerializeIntPacked(ZigZag);
+		if (IsLoading())
+		{
+			Value = static_cast<int32>(ZigZag >> 1) ^ -static_cast<int32>(ZigZag & 1);
+		}
+		return;
+	}
+
+	// 7 bits per byte, the high bit tells if another byte follows
+	uint64 ZigZag = (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+	if (IsSaving())
+	{
+		do
+		{
+			uint8 Byte = ZigZag & 0x7f;
+			ZigZag >>= 7;
+			Byte |= ZigZag != 0 ? 0x80 : 0;
+			InnerArchive << Byte;
+		}
+		while (ZigZag != 0);
+		return;
+	}
+
+	ZigZag = 0;
+	uint8 Byte = 0x80;
+	for (int32 Shift = 0; Shift < 64 && (Byte & 0x80) != 0; Shift += 7)
+	{
+		InnerArchive << Byte;
+		ZigZag |= static_cast<uint64>(Byte & 0x7f) << Shift;
+	}
+	if ((Byte & 0x80) != 0)
+	{
+		SetError();
+	}
+	Value = static_cast<int64>(ZigZag >> 1) ^ -static_cast<int64>(ZigZag & 1);
+}
@@ -15,6 +15,7 @@
 #include "TimelineManager.h"
 
 #include "Timeline.h"
+#include "Async/ParallelFor.h"
 #include "Math/UnitConversion.h"
 
 FNTimelineManager::FNTimelineManager() : Timeline(MakeShared<FNTimeline>()) {}
@@ -24,6 +25,7 @@ FNTimelineManager::~FNTimelineManager() {}
 void FNTimelineManager::TimerTick(const float& InDeltaTime)
 {
 	OnValidateTimelineTick(InDeltaTime);
+	DrainSubmissions();
 	if (State == ENTimelineTimerState::Played)
 	{
 		OnNotifyTimelineTickBefore(InDeltaTime);
@@ -32,6 +34,86 @@ void FNTimelineManager::TimerTick(const float& InDeltaTime)
 	}
 }
 
+void FNTimelineManager::AdvanceBy(const float& InDeltaTime, const FNTimelineAdvancePolicy& Policy)
+{
+	OnValidateTimelineTick(InDeltaTime);
+	DrainSubmissions();
+	if (State == ENTimelineTimerState::Played)
+	{
+		OnNotifyTimelineTickBefore(InDeltaTime);
+		Timeline->AdvanceBy(InDeltaTime, Policy);
+		OnNotifyTimelineTickAfter(InDeltaTime);
+	}
+}
+
+void FNTimelineManager::TickInParallel(const TArray<FNTimelineTickRequest>& Requests)
+{
+	TArray<const FNTimelineTickRequest*> Ticked;
+	Ticked.Reserve(Requests.Num());
+	for (const FNTimelineTickRequest& Request : Requests)
+	{
+		FNTimelineManager* Manager = Request.Manager;
+		Manager->OnValidateTimelineTick(Request.DeltaTime);
+		Manager->DrainSubmissions();
+		if (Manager->State != ENTimelineTimerState::Played) continue;
+
+		Manager->OnNotifyTimelineTickBefore(Request.DeltaTime);
+		Manager->Timeline->bDeferNotifications = true;
+		Ticked.Add(&Request);
+	}
+
+	ParallelFor(
+		Ticked.Num(), [&Ticked](int32 Idx)
+		{
+			Ticked[Idx]->Manager->Timeline->NotifyTick(Ticked[Idx]->DeltaTime);
+		}
+	);
+
+	for (const FNTimelineTickRequest* Request : Ticked)
+	{
+		Request->Manager->Timeline->ReplayDeferredNotifications();
+		Request->Manager->OnNotifyTimelineTickAfter(Request->DeltaTime);
+	}
+}
+
+void FNTimelineManager::StartCatchUp(const float& InDeltaTime)
+{
+	if (InDeltaTime <= 0.f) return;
+
+	Timeline->CatchUpTime += InDeltaTime;
+	Timeline->CatchUpRemainingTime += InDeltaTime;
+}
+
+bool FNTimelineManager::CatchUp(const FNTimelineCatchUpBudget& Budget)
+{
+	if (!Timeline->IsCatchingUp()) return true;
+
+	const double StartTime = FPlatformTime::Seconds();
+	int32 NumTicks = 0;
+	// A listener can clear the timeline or stop this manager during a tick
+	while (Timeline->IsCatchingUp() && State == ENTimelineTimerState::Played)
+	{
+		const float Interval = Timeline->GetTickInterval();
+		const float Remaining = Timeline->CatchUpRemainingTime;
+		const float Delta = Remaining > Interval + KINDA_SMALL_NUMBER ? Interval : Remaining;
+		Timeline->CatchUpRemainingTime = Delta < Remaining ? Remaining - Delta : 0.f;
+		TimerTick(Delta);
+
+		NumTicks++;
+		if (Budget.MaxTicks > 0 && NumTicks >= Budget.MaxTicks) break;
+		if (Budget.MaxMilliseconds > 0.f && (FPlatformTime::Seconds() - StartTime) * 1000.f >= Budget.MaxMilliseconds) break;
+	}
+
+	if (NumTicks == 0) return !Timeline->IsCatchingUp();
+
+	Timeline->CatchUpProgressed.Broadcast(Timeline->GetCatchUpProgress());
+	if (Timeline->IsCatchingUp()) return false;
+
+	Timeline->CatchUpTime = 0.f;
+	Timeline->CatchUpCompleted.Broadcast();
+	return true;
+}
+
 TSharedPtr<FNTimeline> FNTimelineManager::GetTimeline() const
 {
 	return Timeline;
@@ -68,7 +150,7 @@ void FNTimelineManager::Stop()
 }
 
 TSharedPtr<INEvent> FNTimelineManager::CreateNewEvent(const FName& Name, const float& Duration,
-	const float& Delay) const
+	const float& Delay, const FGuid& UID) const
 {
 	FName NewName = Name;
 
@@ -79,7 +161,7 @@ TSharedPtr<INEvent> FNTimelineManager::CreateNewEvent(const FName& Name, const f
 		NewName = FName(*EvtLabel);
 	}
 
-	TSharedPtr<INEvent> Object = MakeShared<FNEvent>(NewName);
+	TSharedPtr<INEvent> Object = Timeline->CreateEvent(NewName, UID);
 	if (Duration > 0)
 	{
 		Object->SetDuration(Duration);
@@ -92,6 +174,46 @@ TSharedPtr<INEvent> FNTimelineManager::CreateNewEvent(const FName& Name, const f
 	return Object;
 }
 
+FGuid FNTimelineManager::EnqueueNewEvent(const FName& Name, const float& Duration, const float& Delay)
+{
+	FNTimelineEventRequest Request;
+	Request.Label = Name;
+	Request.UID = FGuid::NewGuid();
+	Request.Duration = Duration;
+	Request.Delay = Delay;
+	const FGuid UID = Request.UID;
+	Submissions.Enqueue(MoveTemp(Request));
+	return UID;
+}
+
+void FNTimelineManager::EnqueueAttach(TSharedPtr<INEvent>&& Event)
+{
+	FNTimelineEventRequest Request;
+	Request.Event = MoveTemp(Event);
+	Submissions.Enqueue(MoveTemp(Request));
+}
+
+int32 FNTimelineManager::DrainSubmissions()
+{
+	int32 NumAttached = 0;
+	FNTimelineEventRequest Request;
+	while (Submissions.Dequeue(Request))
+	{
+		if (!Request.Event.IsValid())
+		{
+			Request.Event = CreateNewEvent(Request.Label, Request.Duration, Request.Delay, Request.UID);
+		}
+		NumAttached += AttachSubmission(Request.Event) ? 1 : 0;
+		Request.Event.Reset();
+	}
+	return NumAttached;
+}
+
+bool FNTimelineManager::AttachSubmission(const TSharedPtr<INEvent>& Event)
+{
+	return Timeline->Attached(Event);
+}
+
 void FNTimelineManager::Clear()
 {
 	Timeline->Clear();
@@ -102,6 +224,26 @@ FNTimelineEventDelegate& FNTimelineManager::OnEventChanged() const
 	return Timeline->EventChanged;
 }
 
+FNTimelineEventBatchDelegate& FNTimelineManager::OnEventsChanged(const ENTimelineEvent& EventName) const
+{
+	return Timeline->EventsChanged[static_cast<int32>(EventName)];
+}
+
+FNTimelineEventEvictedDelegate& FNTimelineManager::OnExpiredEventEvicted() const
+{
+	return Timeline->ExpiredEventEvicted;
+}
+
+FNTimelineCatchUpProgressDelegate& FNTimelineManager::OnCatchUpProgressed() const
+{
+	return Timeline->CatchUpProgressed;
+}
+
+FNTimelineCatchUpCompletedDelegate& FNTimelineManager::OnCatchUpCompleted() const
+{
+	return Timeline->CatchUpCompleted;
+}
+
 void FNTimelineManager::Archive(FArchive& Ar)
 {
 	Timeline->Archive(Ar);
@@ -0,0 +1,103 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A source of time in secs, sampled by the timeline managers to compute their deltas.
+ * Only the difference between two samples is meaningful.
+ */
+class NANSTIMELINESYSTEMCORE_API INClockSource
+{
+public:
+	virtual ~INClockSource() {}
+
+	/** @returns the current time of this clock in secs */
+	virtual double GetSeconds() const = 0;
+};
+
+/** A monotonic clock (FPlatformTime::Seconds()), it is not affected by timezone or system clock adjustments. */
+class NANSTIMELINESYSTEMCORE_API FNMonotonicClockSource final : public INClockSource
+{
+public:
+	virtual double GetSeconds() const override;
+};
+
+/** The UTC wall clock, it follows the system clock adjustments (NTP, manual changes...). */
+class NANSTIMELINESYSTEMCORE_API FNWallClockSource final : public INClockSource
+{
+public:
+	virtual double GetSeconds() const override;
+};
+
+/** A clock which only moves when it is told to, to run time dependent code deterministically. */
+class NANSTIMELINESYSTEMCORE_API FNTestClockSource final : public INClockSource
+{
+public:
+	virtual double GetSeconds() const override;
+
+	/** Moves the clock forward, a negative value moves it backward */
+	void Advance(const double& InSeconds);
+
+	void SetSeconds(const double& InSeconds);
+
+private:
+	double Seconds = 0.;
+};
+
+/**
+ * Accumulates the time elapsed on a clock source.
+ * The clock is read once per Sample(), the time elapsed between two samples is never lost,
+ * it stays accumulated until it is consumed.
+ */
+class NANSTIMELINESYSTEMCORE_API FNClockAccumulator
+{
+public:
+	/** Uses a FNMonotonicClockSource */
+	FNClockAccumulator();
+
+	explicit FNClockAccumulator(const TSharedRef<INClockSource>& InSource);
+
+	/** Changes the clock source and calls Reset() */
+	void SetSource(const TSharedRef<INClockSource>& InSource);
+
+	TSharedRef<INClockSource> GetSource() const;
+
+	/** Drops the accumulated time, the next Sample() counts from now. */
+	void Reset();
+
+	/**
+	 * Reads the clock and accumulates the time elapsed since the previous sample.
+	 * A clock going backward adds nothing.
+	 * @returns the accumulated time in secs
+	 */
+	double Sample();
+
+	/** @returns the accumulated time in secs, without reading the clock */
+	double GetAccumulated() const;
+
+	/** @returns the accumulated time in secs and resets it, without reading the clock */
+	double Consume();
+
+private:
+	TSharedRef<INClockSource> Source;
+
+	/** The clock time of the previous sample */
+	double LastSeconds = 0.;
+
+	double Accumulated = 0.;
+};
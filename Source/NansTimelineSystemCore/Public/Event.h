@@ -15,6 +15,20 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "TimelineArchive.h"
+
+/**
+ * The time source a FNTimeline shares with its running events.
+ * It allows an event to compute its LocalTime lazily instead of being incremented at each tick.
+ * @see INEvent::BindClock()
+ */
+struct FNTimelineClock
+{
+	/** The current time of the timeline in secs, accumulated in double to keep LocalTime precise on long timelines */
+	double Time = 0.;
+};
+
+class FNEventStore;
 
 /**
 * An interface to manage events which can be attached to a timeline.
@@ -45,6 +59,17 @@ public:
 	/** Retrieve the unique ID generated or given in ctor */
 	virtual FString GetUID() const = 0;
 
+	/**
+	 * Retrieve the unique ID as a FGuid, this is what timelines use to index events.
+	 * Override it to avoid the FString conversion of the default implementation.
+	 */
+	virtual FGuid GetGUID() const
+	{
+		FGuid Id;
+		FGuid::Parse(GetUID(), Id);
+		return Id;
+	}
+
 	/**
 	 * The time relative to the timeline this event has been expired,
 	 * should return -1 if this event has no duration.
@@ -116,10 +141,70 @@ public:
 
 	virtual void Archive(FArchive& Ar) = 0;
 
+	/**
+	 * Saves or loads the event record in the compact format of FNTimeline::Archive().
+	 * The timeline loads records in the events it creates, so the layout of FNEvent::ArchiveRecord() should be kept.
+	 */
+	virtual void ArchiveRecord(FNTimelineArchive& Ar) = 0;
+
+	/**
+	 * Asks the event to compute its LocalTime from the timeline clock.
+	 * The timeline won't call AddTime() anymore for an event which accepts it.
+	 *
+	 * @param InClock - The clock of the timeline this event is started on
+	 * @returns false if the event can't work this way (default), it will then receive AddTime() at each tick.
+	 */
+	virtual bool BindClock(const TSharedRef<const FNTimelineClock>& InClock)
+	{
+		return false;
+	}
+
+	/**
+	 * Stops reading the timeline clock, LocalTime is frozen to the value it has at the given time.
+	 *
+	 * @param InTime - The timeline time (in secs) to freeze LocalTime with
+	 */
+	virtual void UnbindClock(const float& InTime) {}
+
+	/**
+	 * Resets every data to reuse this object as a new event, used by the FNTimeline events pool.
+	 *
+	 * @param InLabel - The label of the new event
+	 * @param InUId - The UID of the new event, a new one is generated if it is not valid
+	 * @returns false if this event can't be reused (default), it is then never pooled.
+	 */
+	virtual bool Recycle(const FName& InLabel, const FGuid& InUId)
+	{
+		return false;
+	}
+
+	/**
+	 * Events which keep their data in a FNEventStore return it here,
+	 * so the timeline which owns this store can tick them without virtual calls.
+	 *
+	 * @param OutIndex - The index of this event in the returned store
+	 * @returns nullptr if the event keeps its own data (default)
+	 */
+	virtual const FNEventStore* GetStore(int32& OutIndex) const
+	{
+		return nullptr;
+	}
+
+	/**
+	 * Called by the timeline when this event moves to its expired events history, it is not ticked anymore.
+	 * Events which keep their data in a FNEventStore copy it and release their index, GetStore() returns nullptr then.
+	 */
+	virtual void ReleaseStore() {}
+
 	friend bool operator==(const TSharedPtr<INEvent>& Event, const FString& InUId)
 	{
 		return InUId == Event->GetUID();
 	}
+
+	friend bool operator==(const TSharedPtr<INEvent>& Event, const FGuid& InUId)
+	{
+		return InUId == Event->GetGUID();
+	}
 };
 
 /** A concrete implementation basically used by FNTimeline  */
@@ -127,8 +212,13 @@ class NANSTIMELINESYSTEMCORE_API FNEvent : public INEvent
 {
 public:
 	FNEvent();
-	/** Ctor to gives directly a name for this event and an Id (optional). */
+	/**
+	 * Ctor to gives directly a name for this event and an Id (optional).
+	 * @param InUId - A FGuid as a string, a new one is generated if it is empty or can't be parsed.
+	 */
 	FNEvent(const FName& InLabel, const FString& InUId = FString(""));
+	/** Ctor to gives directly a name for this event and an Id, a new one is generated if it is not valid. */
+	FNEvent(const FName& InLabel, const FGuid& InUId);
 
 	// ~ Begin INEvent overrides
 	virtual bool IsExpired() const override;
@@ -138,6 +228,7 @@ public:
 	virtual float GetDuration() const override;
 	virtual float GetDelay() const override;
 	virtual FString GetUID() const override;
+	virtual FGuid GetGUID() const override;
 	virtual float GetExpiredTime() const override;
 	virtual FName GetEventLabel() const override;
 	virtual bool IsAttachable() const override;
@@ -152,6 +243,9 @@ public:
 	virtual void AddTime(const float& NewTime) override;
 	virtual void Clear() override;
 	virtual void Archive(FArchive& Ar) override;
+	virtual void ArchiveRecord(FNTimelineArchive& Ar) override;
+	virtual bool BindClock(const TSharedRef<const FNTimelineClock>& InClock) override;
+	virtual void UnbindClock(const float& InTime) override;
 	// ~ End INEvent overrides
 
 protected:
@@ -164,7 +258,21 @@ protected:
 	float ExpiredTime = -1.f;
 	float Duration = 0.f;
 	float Delay = 0.f;
-	FString UId;
+	FGuid UId;
 	bool bActivated = false;
 	bool bIsAttachable = true;
+	/**
+	 * Opts this event in the timeline clock. It is false by default as a bound event stops receiving AddTime(),
+	 * only override it when neither AddTime() nor GetLocalTime() are overridden.
+	 *
+	 * @see BindClock()
+	 */
+	virtual bool ShouldBindClock() const
+	{
+		return false;
+	}
+
+	/** When bound, LocalTime is computed as Clock->Time - ClockOrigin. @see BindClock() */
+	TSharedPtr<const FNTimelineClock> Clock;
+	double ClockOrigin = 0.;
 };
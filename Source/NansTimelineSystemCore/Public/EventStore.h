@@ -0,0 +1,215 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Event.h"
+
+/**
+ * Keeps the data of many events in contiguous arrays (one per field) instead of one object per event.
+ * A FNTimeline using ENTimelineStorage::Packed sweeps these arrays directly when it ticks,
+ * users manipulate the events through FNPackedEvent handles.
+ */
+class NANSTIMELINESYSTEMCORE_API FNEventStore
+{
+	/** The timeline reads and writes the arrays directly in its tick loop */
+	friend class FNTimeline;
+	friend class FNPackedEvent;
+public:
+	/** Flags stored in Flags for each event */
+	enum EFlags : uint8
+	{
+		Allocated = 1 << 0,
+		Activated = 1 << 1,
+		Attachable = 1 << 2,
+	};
+
+	/** The values of one event, kept by a FNPackedEvent once its index is released */
+	struct FValues
+	{
+		float AttachedTime = 0.f;
+		float LocalTime = 0.f;
+		float StartedAt = -1.f;
+		float ExpiredTime = -1.f;
+		float Duration = 0.f;
+		float Delay = 0.f;
+		uint8 Flags = Attachable;
+		FName Label;
+		FGuid UId;
+
+		/** Same as FNEvent::IsExpired() */
+		bool IsExpired() const
+		{
+			return ((Flags & Activated) == 0 && StartedAt > -1.f) || (Duration > 0 && LocalTime >= Duration);
+		}
+	};
+
+	/**
+	 * Reserves an index for a new event, a freed index is reused first.
+	 * @returns the index of the event in every arrays
+	 */
+	int32 Allocate(const FName& InLabel, const FGuid& InUId);
+
+	/** Sets back the default values of an allocated index */
+	void Reset(const int32& Index, const FName& InLabel, const FGuid& InUId);
+
+	/** Releases an index, it will be reused by the next Allocate() call */
+	void Free(const int32& Index);
+
+	/** @returns true if Index is used by an event */
+	bool IsValidIndex(const int32& Index) const
+	{
+		return Flags.IsValidIndex(Index) && (Flags[Index] & Allocated) != 0;
+	}
+
+	/** @returns the number of allocated events */
+	int32 Num() const
+	{
+		return Flags.Num() - FreeIndexes.Num();
+	}
+
+	/** Same as FNEvent::IsExpired() */
+	bool IsExpired(const int32& Index) const
+	{
+		return ((Flags[Index] & Activated) == 0 && StartedAts[Index] > -1.f)
+			   || (Durations[Index] > 0 && LocalTimes[Index] >= Durations[Index]);
+	}
+
+	/** Same as FNEvent::Clear() */
+	void Clear(const int32& Index);
+
+	/** @returns a copy of the values of an allocated index */
+	FValues GetValues(const int32& Index) const;
+
+	/** Writes back values of an allocated index, its Steps is kept */
+	void SetValues(const int32& Index, const FValues& InValues);
+
+	/**
+	 * Adds InDeltaTime to the LocalTime of every ticked events (Steps != 0) and flags the ones which reach their duration.
+	 * The vector kernel is used when it is enabled and supported, both kernels give the same results.
+	 *
+	 * @param OutExpiredBits - One bit per index, set when the event reaches its duration
+	 * @param ChunkSize - When > 0, the store is advanced in parallel by chunks of this size (rounded up to 32 events)
+	 */
+	void Advance(const float& InDeltaTime, TArray<uint32>& OutExpiredBits, const int32& ChunkSize = 0);
+
+	/**
+	 * The kernels used by Advance(), exposed to be compared and benchmarked.
+	 * For each Idx < Num: PreviousLocalTimes[Idx] = LocalTimes[Idx], LocalTimes[Idx] += InDeltaTime * Steps[Idx]
+	 * and the bit Idx of OutExpiredBits is set if Steps[Idx] != 0 && Durations[Idx] > 0 && LocalTimes[Idx] >= Durations[Idx].
+	 * OutExpiredBits should have at least (Num + 31) / 32 elements, set to 0.
+	 */
+	static void AdvanceScalar(
+		float* LocalTimes, float* PreviousLocalTimes, const float* Steps, const float* Durations, const int32& Num,
+		const float& InDeltaTime, uint32* OutExpiredBits
+	);
+
+	/** @copydoc AdvanceScalar() */
+	static void AdvanceVector(
+		float* LocalTimes, float* PreviousLocalTimes, const float* Steps, const float* Durations, const int32& Num,
+		const float& InDeltaTime, uint32* OutExpiredBits
+	);
+
+	/** @returns true if AdvanceVector() uses vector intrinsics on this platform, it falls back on AdvanceScalar() otherwise */
+	static bool IsVectorKernelSupported();
+
+	/** Selects at runtime the kernel used by Advance(), enabled by default. */
+	static void SetVectorKernelEnabled(const bool& bInEnabled);
+
+	/** @returns true if Advance() uses AdvanceVector() */
+	static bool IsVectorKernelEnabled();
+
+private:
+	/** @see SetVectorKernelEnabled() */
+	static bool bVectorKernelEnabled;
+
+	TArray<float> AttachedTimes;
+	TArray<float> LocalTimes;
+	/** LocalTimes before the last Advance(), to restore an event stopped after it has been advanced. */
+	TArray<float> PreviousLocalTimes;
+	/** 1 when the event is ticked by its timeline, 0 otherwise. A float to be used directly by the kernels. */
+	TArray<float> Steps;
+	TArray<float> StartedAts;
+	TArray<float> ExpiredTimes;
+	TArray<float> Durations;
+	TArray<float> Delays;
+	TArray<uint8> Flags;
+	TArray<FName> Labels;
+	TArray<FGuid> UIds;
+
+	/** Indexes released by Free() */
+	TArray<int32> FreeIndexes;
+};
+
+/**
+ * An INEvent which owns nothing but an index in a FNEventStore.
+ * Its index is released when the handle is destroyed, or when its timeline calls ReleaseStore() on expiry:
+ * the handle keeps a copy of its values then, so the store doesn't grow with the expired events history.
+ * @see FNTimeline::CreateEvent()
+ */
+class NANSTIMELINESYSTEMCORE_API FNPackedEvent final : public INEvent
+{
+public:
+	FNPackedEvent(const TSharedRef<FNEventStore>& InStore, const FName& InLabel, const FGuid& InUId);
+	virtual ~FNPackedEvent();
+
+	FNPackedEvent(const FNPackedEvent&) = delete;
+	FNPackedEvent& operator=(const FNPackedEvent&) = delete;
+
+	// ~ Begin INEvent overrides
+	virtual bool IsExpired() const override;
+	virtual float GetLocalTime() const override;
+	virtual float GetAttachedTime() const override;
+	virtual float GetStartedAt() const override;
+	virtual float GetDuration() const override;
+	virtual float GetDelay() const override;
+	virtual FString GetUID() const override;
+	virtual FGuid GetGUID() const override;
+	virtual float GetExpiredTime() const override;
+	virtual FName GetEventLabel() const override;
+	virtual bool IsAttachable() const override;
+	virtual void SetEventLabel(const FName& InEventLabel) override;
+	virtual void SetAttachedTime(const float& InLocalTime) override;
+	virtual void SetAttachable(const bool& bInIsAttachable) override;
+	virtual void SetExpiredTime(const float& InLocalTime) override;
+	virtual void SetDuration(const float& InDuration) override;
+	virtual void SetDelay(const float& InDelay) override;
+	virtual void Start(const float& StartTime) override;
+	virtual void Stop() override;
+	virtual void AddTime(const float& NewTime) override;
+	virtual void Clear() override;
+	virtual void Archive(FArchive& Ar) override;
+	virtual void ArchiveRecord(FNTimelineArchive& Ar) override;
+	virtual bool Recycle(const FName& InLabel, const FGuid& InUId) override;
+	virtual const FNEventStore* GetStore(int32& OutIndex) const override;
+	virtual void ReleaseStore() override;
+	// ~ End INEvent overrides
+
+private:
+	/** @returns true while the event data is in Store */
+	bool HasIndex() const
+	{
+		return Index != INDEX_NONE;
+	}
+
+	/** Writes loaded values in the store, or in Values once the index is released */
+	void SetRecord(FNEventStore::FValues& Record, const bool& bActivated);
+
+	TSharedRef<FNEventStore> Store;
+	/** INDEX_NONE once ReleaseStore() has been called */
+	int32 Index;
+	/** The event data once its index is released */
+	FNEventStore::FValues Values;
+};
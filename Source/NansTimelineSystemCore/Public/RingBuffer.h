@@ -0,0 +1,102 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A FIFO collection which reuses its allocation: removing the oldest item is O(1) and never moves other items.
+ * It grows like a TArray when it is full.
+ */
+template <typename T>
+class TNRingBuffer
+{
+public:
+	/** @returns the number of items */
+	int32 Num() const
+	{
+		return Count;
+	}
+
+	/** @param Index - 0 is the oldest item */
+	T& operator[](const int32& Index)
+	{
+		check(Index >= 0 && Index < Count);
+		return Data[Wrap(Head + Index)];
+	}
+
+	/** @param Index - 0 is the oldest item */
+	const T& operator[](const int32& Index) const
+	{
+		check(Index >= 0 && Index < Count);
+		return Data[Wrap(Head + Index)];
+	}
+
+	/** Adds an item after the newest one */
+	void Add(T&& Item)
+	{
+		if (Count == Data.Num())
+		{
+			Reserve(FMath::Max(8, Count * 2));
+		}
+		Data[Wrap(Head + Count)] = MoveTemp(Item);
+		Count++;
+	}
+
+	/** Removes the oldest item and returns it */
+	T PopFirst()
+	{
+		check(Count > 0);
+		T Item = MoveTemp(Data[Head]);
+		Data[Head] = T();
+		Head = Wrap(Head + 1);
+		Count--;
+		return Item;
+	}
+
+	/** Makes room for InCapacity items, items are moved only when it grows */
+	void Reserve(const int32& InCapacity)
+	{
+		if (InCapacity <= Data.Num()) return;
+
+		TArray<T> NewData;
+		NewData.SetNum(InCapacity);
+		for (int32 Idx = 0; Idx < Count; Idx++)
+		{
+			NewData[Idx] = MoveTemp(Data[Wrap(Head + Idx)]);
+		}
+		Data = MoveTemp(NewData);
+		Head = 0;
+	}
+
+	/** Removes every items and frees the allocation */
+	void Empty()
+	{
+		Data.Empty();
+		Head = 0;
+		Count = 0;
+	}
+
+private:
+	int32 Wrap(const int32& Index) const
+	{
+		return Index >= Data.Num() ? Index - Data.Num() : Index;
+	}
+
+	TArray<T> Data;
+	/** The index in Data of the oldest item */
+	int32 Head = 0;
+	int32 Count = 0;
+};
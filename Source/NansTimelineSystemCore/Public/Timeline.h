@@ -16,6 +16,8 @@
 
 #include "CoreMinimal.h"
 #include "Event.h"
+#include "EventStore.h"
+#include "RingBuffer.h"
 
 class FNTimelineManager;
 
@@ -49,6 +51,19 @@ enum class ENTimelineEvent : uint8
 	Tick,
 };
 
+/** How the events created by a FNTimeline keep their data. @see FNTimeline::CreateEvent() */
+enum class ENTimelineStorage : uint8
+{
+	/** Each event is a FNEvent object */
+	Objects,
+
+	/**
+	 * Events are FNPackedEvent handles in a FNEventStore owned by the timeline,
+	 * ticking them is a sweep over contiguous arrays.
+	 */
+	Packed,
+};
+
 DECLARE_MULTICAST_DELEGATE_FourParams(
 	FNTimelineEventDelegate,
 	TSharedPtr<INEvent> /** Event */,
@@ -57,6 +72,221 @@ DECLARE_MULTICAST_DELEGATE_FourParams(
 	const int32& /** Index */
 );
 
+/** One notification of a FNTimelineEventBatchDelegate, it holds the FNTimelineEventDelegate params. */
+struct FNTimelineNotification
+{
+	FNTimelineNotification() {}
+	FNTimelineNotification(const TSharedPtr<INEvent>& InEvent, const ENTimelineEvent& InEventName, const float& InTime,
+		const int32& InIndex)
+		: Event(InEvent), EventName(InEventName), Time(InTime), Index(InIndex) {}
+
+	TSharedPtr<INEvent> Event;
+	ENTimelineEvent EventName = ENTimelineEvent::Tick;
+	float Time = 0.f;
+	int32 Index = INDEX_NONE;
+};
+
+/**
+ * Receives all the notifications of one ENTimelineEvent type at once, in the order they happened.
+ * The view is only valid during the call.
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(
+	FNTimelineEventBatchDelegate,
+	TArrayView<const FNTimelineNotification> /** Notifications */
+);
+
+/** Counters of the FNTimeline events pool. @see FNTimeline::SetPoolCapacity() */
+struct FNEventPoolStats
+{
+	/** CreateEvent() calls which reused a pooled event */
+	int32 Hits = 0;
+
+	/** CreateEvent() calls which had to allocate a new event */
+	int32 Misses = 0;
+
+	/** Expired events put back in the pool */
+	int32 Recycled = 0;
+
+	/** Events currently in the pool */
+	int32 Pooled = 0;
+};
+
+/** What a FNTimeline keeps of its expired events. @see FNExpiredEventsPolicy */
+enum class ENExpiredEventsRetention : uint8
+{
+	/** Every expired events are kept */
+	All,
+
+	/** Only the FNExpiredEventsPolicy::MaxEvents last expired events are kept */
+	Last,
+
+	/** Expired events are kept FNExpiredEventsPolicy::Lifespan seconds after they expire */
+	Lifespan,
+
+	/** Expired events are dropped as soon as they expire */
+	None,
+};
+
+/** @see FNTimeline::SetExpiredEventsPolicy() */
+struct FNExpiredEventsPolicy
+{
+	ENExpiredEventsRetention Retention = ENExpiredEventsRetention::All;
+
+	/** Used with ENExpiredEventsRetention::Last */
+	int32 MaxEvents = 0;
+
+	/** Used with ENExpiredEventsRetention::Lifespan, in secs */
+	float Lifespan = 0.f;
+
+	/** true to aggregate the evicted events in a FNExpiredEventsSummary */
+	bool bSummarize = false;
+};
+
+/** The compact record of the expired events evicted by a FNTimeline. @see FNExpiredEventsPolicy::bSummarize */
+struct FNExpiredEventsSummary
+{
+	/** The number of evicted events */
+	int32 Num = 0;
+
+	/** The timeline time the oldest evicted event expired at */
+	float FirstExpiredTime = 0.f;
+
+	/** The timeline time the newest evicted event expired at */
+	float LastExpiredTime = 0.f;
+
+	/** The sum of the local times of evicted events */
+	float TotalLocalTime = 0.f;
+};
+
+/** Receives the UID of an expired event removed from the history of a FNTimeline. */
+DECLARE_MULTICAST_DELEGATE_OneParam(
+	FNTimelineEventEvictedDelegate,
+	const FGuid& /** UID */
+);
+
+/** An expired event kept by a FNTimeline */
+struct FNExpiredEventEntry
+{
+	FNExpiredEventEntry() {}
+	FNExpiredEventEntry(TSharedPtr<INEvent>&& InEvent, FGuid&& InUID, const float& InExpiredTime)
+		: Event(MoveTemp(InEvent)), UID(MoveTemp(InUID)), ExpiredTime(InExpiredTime) {}
+	FNExpiredEventEntry(FGuid&& InUID, const int32& InRecordOffset)
+		: UID(MoveTemp(InUID)), RecordOffset(InRecordOffset) {}
+
+	/** Invalid until its record is read, when it has been loaded lazily. @see RecordOffset */
+	mutable TSharedPtr<INEvent> Event;
+	FGuid UID;
+
+	/** The timeline time it expired at, read with Event */
+	mutable float ExpiredTime = 0.f;
+
+	/** The position of its record in the loaded FNEventRecords, INDEX_NONE if it has not been loaded lazily */
+	int32 RecordOffset = INDEX_NONE;
+};
+
+/** Event records kept as they have been loaded, to read them only when they are accessed. */
+struct FNEventRecords
+{
+	TArray<uint8> Data;
+
+	/** The labels table of the records */
+	TArray<FName> Names;
+
+	/** @see FNTimelineArchive */
+	bool bPackedTimes = false;
+
+	/** The ENTimelineArchiveVersion the records have been saved with */
+	int32 Version = static_cast<int32>(ENTimelineArchiveVersion::Latest);
+};
+
+/** @see FNTimeline::AdvanceBy() */
+struct FNTimelineAdvancePolicy
+{
+	/**
+	 * false to skip ENTimelineEvent::Tick notifications,
+	 * true to notify once each event which is still running at the end.
+	 */
+	bool bCoalesceTicks = false;
+
+	/** The interval of the ticks to catch up with, in secs. 0 to use the timeline tick interval. */
+	float Interval = 0.f;
+};
+
+/** How much of a catch-up backlog is replayed by one call. @see FNTimelineManager::CatchUp() */
+struct FNTimelineCatchUpBudget
+{
+	/** The max number of ticks replayed, 0 for no limit */
+	int32 MaxTicks = 0;
+
+	/** The max time spent replaying ticks in millisecs, 0 for no limit. At least one tick is replayed anyway. */
+	float MaxMilliseconds = 0.f;
+};
+
+/** Receives the ratio of a catch-up backlog already replayed, from 0 to 1. */
+DECLARE_MULTICAST_DELEGATE_OneParam(
+	FNTimelineCatchUpProgressDelegate,
+	const float& /** Progress */
+);
+
+/** Broadcast when the whole catch-up backlog has been replayed. */
+DECLARE_MULTICAST_DELEGATE(FNTimelineCatchUpCompletedDelegate);
+
+/** What happened to a running event during a tick. @see FNTimeline::AdvanceRunningEvent() */
+enum class ENRunningEventUpdate : uint8
+{
+	Running,
+
+	/** It reached its end during this tick, it is notified with Tick then Expired */
+	Expired,
+
+	/** It has been stopped since the previous tick, it is only notified with Expired */
+	Stopped,
+};
+
+/** A running event which expired during a parallel sweep. @see FNTimeline::SetParallelSweepThreshold() */
+struct FNSweepExpiry
+{
+	FNSweepExpiry() {}
+	FNSweepExpiry(const int32& InRunningIndex, const ENRunningEventUpdate& InUpdate)
+		: RunningIndex(InRunningIndex), Update(InUpdate) {}
+
+	/** Its index in the running events */
+	int32 RunningIndex = INDEX_NONE;
+
+	ENRunningEventUpdate Update = ENRunningEventUpdate::Running;
+};
+
+/**
+ * The data a FNTimeline keeps alongside each attached event to schedule it.
+ */
+struct FNTimelineEventEntry
+{
+	FNTimelineEventEntry() {}
+	FNTimelineEventEntry(const TSharedPtr<INEvent>& InEvent, const int32& InSequence)
+		: Event(InEvent), Sequence(InSequence) {}
+
+	/** The scheduled event */
+	TSharedPtr<INEvent> Event;
+
+	/** The attachment order in its timeline */
+	int32 Sequence = 0;
+
+	/** Cached INEvent::GetGUID() to maintain the timeline UID indexes without a virtual call. */
+	FGuid UID;
+
+	/** The timeline time this event should start at (attached time + delay) */
+	float StartTime = 0.f;
+
+	/** true if the event computes its LocalTime from the timeline clock. @see INEvent::BindClock() */
+	bool bIsClockBound = false;
+
+	/** The index of the event in the timeline FNEventStore, INDEX_NONE if it keeps its own data. */
+	int32 StoreIndex = INDEX_NONE;
+
+	/** false to skip ENTimelineEvent::Tick notifications of this event. @see FNTimeline::SetTickNotified() */
+	bool bNotifyTick = true;
+};
+
 /**
  * @see NTimelineInterface
  */
@@ -65,12 +295,16 @@ class NANSTIMELINESYSTEMCORE_API FNTimeline final
 	/** Only the FNTimelineManager can tick a timeline object */
 	friend class FNTimelineManager;
 public:
+	/** The number of ENTimelineEvent values */
+	static constexpr int32 NumEventNames = static_cast<int32>(ENTimelineEvent::Tick) + 1;
+
 	FNTimeline();
 
 	/**
 	 * @param InLabel - (optional) The name of this timeline. If not provided it creates a name with a static incremented value.
+	 * @param InStorage - How the events created by this timeline keep their data
 	 */
-	FNTimeline(const FName& InLabel);
+	FNTimeline(const FName& InLabel, const ENTimelineStorage& InStorage = ENTimelineStorage::Objects);
 
 	/** Empty events array */
 	~FNTimeline();
@@ -111,6 +345,77 @@ public:
 	/** Return the actual name */
 	FName GetLabel() const;
 
+	/**
+	 * Changes how the events created by this timeline keep their data.
+	 * @returns false if the timeline has already some events, the storage can't be changed anymore.
+	 */
+	bool SetStorage(const ENTimelineStorage& InStorage);
+
+	/** @see ENTimelineStorage */
+	ENTimelineStorage GetStorage() const;
+
+	/**
+	 * Creates an event using the storage of this timeline, it reuses a pooled event when possible.
+	 * Any other INEvent can still be attached, it is just ticked through its virtual methods.
+	 *
+	 * @param InLabel - The label of the event
+	 * @param InUId - (optional) a new one is generated if it is not valid
+	 */
+	TSharedRef<INEvent> CreateEvent(const FName& InLabel, const FGuid& InUId = FGuid());
+
+	/**
+	 * Enables the events pool when InCapacity > 0 (disabled by default).
+	 * Then an event created by CreateEvent() is put back in the pool when it expires,
+	 * instead of being kept in the expired events, if nothing else holds a reference on it.
+	 * FNTimelineManager::OnExpiredEventEvicted() is broadcast for a pooled event, as it never enters the history.
+	 *
+	 * @param InCapacity - The max number of pooled events, extra events are released
+	 */
+	void SetPoolCapacity(const int32& InCapacity);
+
+	/** @see FNEventPoolStats */
+	FNEventPoolStats GetPoolStats() const;
+
+	/**
+	 * Running events are advanced in parallel, by chunks, when there are at least InThreshold of them.
+	 * Notifications are still sent in the same order as with a serial tick,
+	 * but an event stopped by a listener during the tick is only seen at the next tick, as it is already advanced.
+	 * The events must not share any state, which is the case of the events created by CreateEvent().
+	 *
+	 * @param InThreshold - The number of running events, 0 disables it
+	 */
+	void SetParallelSweepThreshold(const int32& InThreshold);
+
+	/** @see SetParallelSweepThreshold() */
+	int32 GetParallelSweepThreshold() const;
+
+	/** The default of SetParallelSweepThreshold() */
+	static constexpr int32 DefaultParallelSweepThreshold = 16384;
+
+	/** The number of running events advanced by a worker during a parallel sweep */
+	static constexpr int32 ParallelSweepChunkSize = 4096;
+
+	/**
+	 * Bounds the expired events history, every expired events are kept by default.
+	 * Evicted events are removed from the oldest, the Lifespan retention is applied at each tick.
+	 */
+	void SetExpiredEventsPolicy(const FNExpiredEventsPolicy& InPolicy);
+
+	/** @see SetExpiredEventsPolicy() */
+	FNExpiredEventsPolicy GetExpiredEventsPolicy() const;
+
+	/** @see FNExpiredEventsPolicy::bSummarize */
+	FNExpiredEventsSummary GetExpiredEventsSummary() const;
+
+	/** true while its manager replays a backlog of time across several calls. @see FNTimelineManager::StartCatchUp() */
+	bool IsCatchingUp() const;
+
+	/** @returns the ratio of the catch-up backlog already replayed, 1 when it is not catching up */
+	float GetCatchUpProgress() const;
+
+	/** @returns the time of the catch-up backlog still to replay, in secs */
+	float GetCatchUpRemainingTime() const;
+
 	/**
 	 * This completely reset every events.
 	 * It should be used with caution.
@@ -119,9 +424,17 @@ public:
 
 	/**
 	* Offer the opportunities to save data in a binary object.
+	* Saves of any ENTimelineArchiveVersion are loaded.
 	* @param Ar - Archive where we need to save or load data.
+	* @param SaveVersion - The format used when saving
 	*/
-	void Archive(FArchive& Ar);
+	void Archive(FArchive& Ar, const ENTimelineArchiveVersion& SaveVersion = ENTimelineArchiveVersion::Latest);
+
+	/**
+	 * Rounds times to the millisecond in saves to write them as varints, this makes saves much smaller.
+	 * Disabled by default, saves made this way are still loaded by timelines which don't use it.
+	 */
+	void SetArchivePackedTimes(const bool& bInPackedTimes);
 
 	/** @returns Get the list of all events saved in this timeline */
 	TArray<TSharedPtr<INEvent>> GetEvents() const;
@@ -133,13 +446,48 @@ public:
 	* Get an event by its UID
 	* @returns the event found or invalid TSharedPtr
 	*/
+	TSharedPtr<INEvent> GetEvent(const FGuid& InUID) const;
+
+	/**
+	* Get an event by its UID as a string, prefer the FGuid version which doesn't need to parse it.
+	* @returns the event found or invalid TSharedPtr
+	*/
 	TSharedPtr<INEvent> GetEvent(const FString& InUID) const;
 
 	/**
 	* Get an event by its UID
 	* @returns the event found or invalid TSharedPtr
 	*/
+	TSharedPtr<INEvent> GetExpiredEvent(const FGuid& InUID) const;
+
+	/**
+	* Get an event by its UID as a string, prefer the FGuid version which doesn't need to parse it.
+	* @returns the event found or invalid TSharedPtr
+	*/
 	TSharedPtr<INEvent> GetExpiredEvent(const FString& InUID) const;
+
+	/**
+	 * @returns true if this expired event exists and has been created,
+	 * false if its record has not been read yet since the load. @see GetExpiredEvent()
+	 */
+	bool IsExpiredEventResolved(const FGuid& InUID) const;
+
+	/**
+	* Allows to skip the ENTimelineEvent::Tick notifications of an event which has nothing to do on tick.
+	* Every listener of the timeline stops receiving them, so only the owner of all the listeners should use it.
+	* This is not saved by Archive(), it should be set again after a load.
+	* @param InUID - The UID of a live event
+	* @param bInNotified - false to skip its Tick notifications
+	* @returns false if the event is not found
+	*/
+	bool SetTickNotified(const FGuid& InUID, const bool& bInNotified);
+
+	/**
+	* Get a live event by the Index given with FNTimelineEventDelegate.
+	* An Index is kept by an event until it expires, then it can be reused by a new event.
+	* @returns the event found or invalid TSharedPtr
+	*/
+	TSharedPtr<INEvent> GetEventAt(const int32& Index) const;
 private:
 	/** The name of this timeline */
 	FName Label;
@@ -173,28 +521,255 @@ private:
 	 * This is used to managed and event when it expires.
 	 * Triggers ENTimelineEvent::Expired event with EventChanged
 	 */
-	void OnExpired(const TSharedPtr<INEvent>& Event, const float& ExpiredTime, const int32& Index) const;
+	void OnExpired(const TSharedPtr<INEvent>& Event, const float& ExpiredTime, const int32& Index);
+
+	/**
+	 * Broadcasts EventChanged right away (unless bDeferNotifications) and queues the notification for the EventsChanged delegate of its type,
+	 * only if someone listens to it.
+	 */
+	void Notify(const TSharedPtr<INEvent>& Event, const ENTimelineEvent& EventName, const float& Time,
+		const int32& Index);
+
+	/**
+	 * Saves or loads an ENTimelineArchiveVersion::Compact archive (or newer), after its header.
+	 * Since ENTimelineArchiveVersion::IndexedExpiredEvents, only the UIDs of expired events are read on load,
+	 * their records are kept in ExpiredRecords to create them on first access.
+	 */
+	void ArchiveCompact(FArchive& Ar, const int32& Version);
+
+	/**
+	 * @returns the entry of ExpiredEvents at this index,
+	 * its event is created from ExpiredRecords first if it has been loaded lazily.
+	 */
+	const FNExpiredEventEntry& ResolveExpiredEntry(const int32& Index) const;
+
+	/** Saves or loads an ENTimelineArchiveVersion::Legacy archive, which has no header. */
+	void ArchiveLegacy(FArchive& Ar);
+
+	/** Broadcasts the queued notifications with EventsChanged, one batch per type. Nothing is done while they are deferred. */
+	void FlushNotifications();
+
+	/**
+	 * Broadcasts the notifications and evictions deferred during a NotifyTick() run off the game thread,
+	 * in the order they happened, then finishes the tick: expired slots are released and the batches are flushed.
+	 * @see FNTimelineManager::TickInParallel()
+	 */
+	void ReplayDeferredNotifications();
+
+	/** Adds an event in the expired events history, depending on ExpiredEventsPolicy. */
+	void AddExpiredEvent(FNExpiredEventEntry&& Entry);
+
+	/** Evicts the expired events which are out of ExpiredEventsPolicy. */
+	void ApplyExpiredEventsPolicy();
+
+	/** Removes the oldest expired event. */
+	void EvictExpiredEvent();
+
+	/** Summarizes an event which leaves the history and broadcasts ExpiredEventEvicted. */
+	void OnExpiredEventEvicted(const FNExpiredEventEntry& Entry);
+
+	/** Broadcasts ExpiredEventEvicted for an event which leaves the history or is pooled instead of entering it. */
+	void BroadcastExpiredEventEvicted(const FGuid& UID);
 
 	/**
 	 * This is used to managed and event when it starts.
+	 * It binds the event to the Clock when possible.
 	 * Triggers ENTimelineEvent::Start event with EventChanged
 	 */
-	void StartEvent(const TSharedPtr<INEvent>& Event, const int32& Index) const;
+	void StartEvent(const int32& Slot);
 
 	/**
 	 * This manages to notify every events saved in this timeline with the new time added.
+	 * Only running events and delayed events which are due are visited,
+	 * they are notified in their attachment order.
 	 */
 	void NotifyTick(const float& InDeltaTime);
 
-	/** Collection of each Events attached to the timeline. */
-	TArray<TSharedPtr<INEvent>> Events;
+	/**
+	 * Jumps InDelta secs forward in one call, for example to catch up with the time elapsed while the game was off.
+	 * Events start and expire at the same times than with NotifyTick() called every Policy.Interval,
+	 * but only those which start or expire are visited, and their LocalTime is added once.
+	 * Start and Expired notifications are batched in their chronological order.
+	 * An event attached by a listener is taken into account from the tick it is attached at.
+	 */
+	void AdvanceBy(const float& InDelta, const FNTimelineAdvancePolicy& Policy = FNTimelineAdvancePolicy());
+
+	/**
+	 * Ends NotifyTick() or AdvanceBy(): releases the expired slots, applies the expired events policy and flushes the batches.
+	 * When notifications are deferred, NotifyTick() leaves it to ReplayDeferredNotifications().
+	 */
+	void FinishTick();
+
+	/** Moves the events of ExpiredSlots to the expired events history (or to the pool) and frees their slots. */
+	void ReleaseExpiredSlots();
+
+	/**
+	 * Ticks a running event.
+	 * @returns false if the event expired during this tick.
+	 */
+	bool TickRunningEvent(const int32& Slot, const float& InDeltaTime, const float& PreviousTime);
+
+	/**
+	 * Same as TickRunningEvent() without any notification, so it can run on any thread.
+	 * It is only used when nothing listens to EventChanged, nothing can change the event between its steps then.
+	 */
+	ENRunningEventUpdate AdvanceRunningEvent(const int32& Slot, const float& InDeltaTime, const float& PreviousTime);
+
+	/**
+	 * Advances every running events with AdvanceRunningEvent() in parallel, by chunks of ParallelSweepChunkSize.
+	 * Each chunk collects its own expiries, they are merged in RunningEvents order into SweepExpiries.
+	 */
+	void AdvanceRunningEventsInParallel(const float& InDeltaTime, const float& PreviousTime);
+
+	/**
+	 * Sends the notifications of an event advanced by AdvanceRunningEventsInParallel(), like TickRunningEvent() does,
+	 * and unbinds the clock of an expired event.
+	 * @returns false if the event expired during this tick.
+	 */
+	bool NotifyRunningEvent(const int32& Slot, const ENRunningEventUpdate& Update, const float& PreviousTime);
+
+	/**
+	 * Same as TickRunningEvent() for an event of EventStore, its data are read without virtual calls.
+	 * Its LocalTime has already been advanced by FNEventStore::Advance() at the beginning of the tick.
+	 */
+	bool TickPackedEvent(const int32& Slot);
+
+	/** Puts an event which is not started yet in the PendingEvents heap. */
+	void ScheduleEvent(const int32& Slot);
+
+	/** Freezes LocalTime of all running events and empties scheduling collections. */
+	void ResetSchedule();
+
+	/**
+	 * Adds the event in Events and in the EventSlotsByUID index.
+	 * @returns the slot of the event
+	 */
+	int32 AddEventEntry(const TSharedPtr<INEvent>& Event);
+
+	/** Fills Events, RunningEvents & PendingEvents from a list of events, used after a load. */
+	void RestoreEvents(const TArray<TSharedPtr<INEvent>>& InEvents);
+
+	/**
+	 * Collection of each Events attached to the timeline.
+	 * An event keeps its slot until it expires, the slot is the Index given to FNTimelineEventDelegate.
+	 * A freed slot is reused, so removing an expired event costs O(1).
+	 */
+	TSparseArray<FNTimelineEventEntry> Events;
+
+	/** Slots of events which have started and are not expired yet, sorted by attachment order. */
+	TArray<int32> RunningEvents;
+
+	/**
+	 * Slots of events waiting for their delay to elapse.
+	 * This is a min-heap on FNTimelineEventEntry::StartTime, so a tick only checks its top.
+	 */
+	TArray<int32> PendingEvents;
+
+	/** A buffer reused at each tick to rebuild RunningEvents, avoid an allocation per tick. */
+	TArray<int32> SweepBuffer;
+
+	/** Slots of pending events which are due at the current tick, reused at each tick. */
+	TArray<int32> DueEvents;
+
+	/** Slots of events which expired during the current tick or catch up, they are freed by ReleaseExpiredSlots(). */
+	TArray<int32> ExpiredSlots;
+
+	/** @see SetParallelSweepThreshold() */
+	int32 ParallelSweepThreshold = DefaultParallelSweepThreshold;
+
+	/** Filled by AdvanceRunningEventsInParallel(), sorted by running index */
+	TArray<FNSweepExpiry> SweepExpiries;
+
+	/** @see ENTimelineStorage */
+	ENTimelineStorage Storage = ENTimelineStorage::Objects;
 
-	/** Collection of each Events attached to the timeline. */
-	TArray<TSharedPtr<INEvent>> ExpiredEvents;
+	/** Data of the events created by CreateEvent() in ENTimelineStorage::Packed mode. */
+	TSharedRef<FNEventStore> EventStore;
+
+	/** Filled by FNEventStore::Advance() at each tick, one bit per store index. */
+	TArray<uint32> ExpiredBits;
+
+	/** Expired events waiting to be reused by CreateEvent(). @see SetPoolCapacity() */
+	TArray<TSharedRef<INEvent>> Pool;
+
+	/** @see SetPoolCapacity() */
+	int32 PoolCapacity = 0;
+
+	/** @see GetPoolStats() */
+	FNEventPoolStats PoolStats;
+
+	/** Shared with running events to let them compute their LocalTime lazily. */
+	TSharedRef<FNTimelineClock> Clock;
+
+	/** Incremented at each attachment. @see FNTimelineEventEntry::Sequence */
+	int32 NextSequence = 0;
+
+	/** The expired events history, from the oldest. @see SetExpiredEventsPolicy() */
+	TNRingBuffer<FNExpiredEventEntry> ExpiredEvents;
+
+	/** The number of events evicted from ExpiredEvents since the last Clear() */
+	int32 NumEvictedEvents = 0;
+
+	/** @see SetExpiredEventsPolicy() */
+	FNExpiredEventsPolicy ExpiredEventsPolicy;
+
+	/** @see GetExpiredEventsSummary() */
+	FNExpiredEventsSummary ExpiredEventsSummary;
+
+	/** @see SetArchivePackedTimes() */
+	bool bArchivePackedTimes = false;
+
+	/** The whole time of the current catch-up backlog, 0 when it is not catching up. @see IsCatchingUp() */
+	float CatchUpTime = 0.f;
+
+	/** @see GetCatchUpRemainingTime() */
+	float CatchUpRemainingTime = 0.f;
+
+	/** The records of the loaded expired events, @see ResolveExpiredEntry() */
+	TSharedPtr<FNEventRecords> ExpiredRecords;
+
+	/** The slot in Events of each live event by its UID, @see GetEvent() */
+	TMap<FGuid, int32> EventSlotsByUID;
+
+	/**
+	 * The position of each expired event by its UID, @see GetExpiredEvent()
+	 * It counts evicted events, so the index in ExpiredEvents is the position minus NumEvictedEvents.
+	 */
+	TMap<FGuid, int32> ExpiredEventIndexesByUID;
 
 	/** @see FTimeline() */
 	FNTimelineEventDelegate EventChanged;
 
+	/** @see AddExpiredEvent() */
+	FNTimelineEventEvictedDelegate ExpiredEventEvicted;
+
+	/** @see FNTimelineManager::CatchUp() */
+	FNTimelineCatchUpProgressDelegate CatchUpProgressed;
+
+	/** @see FNTimelineManager::CatchUp() */
+	FNTimelineCatchUpCompletedDelegate CatchUpCompleted;
+
+	/** Batched notifications by ENTimelineEvent, flushed at the end of a tick or of an attachment. */
+	FNTimelineEventBatchDelegate EventsChanged[NumEventNames];
+
+	/** Notifications waiting for FlushNotifications(), by ENTimelineEvent */
+	TArray<FNTimelineNotification> PendingNotifications[NumEventNames];
+
+	/** true during NotifyTick(), notifications are flushed once at its end. */
+	bool bIsTicking = false;
+
+	/** When true, no delegate is broadcast, they are replayed later by ReplayDeferredNotifications(). */
+	bool bDeferNotifications = false;
+
+	/** The EventChanged broadcasts waiting for ReplayDeferredNotifications() */
+	TArray<FNTimelineNotification> DeferredNotifications;
+
+	/** The ExpiredEventEvicted broadcasts waiting for ReplayDeferredNotifications() */
+	TArray<FGuid> DeferredEvictions;
+
+	/** Computed at the beginning of NotifyTick(), Tick notifications are skipped when nobody listens to them. */
+	bool bIsTickObserved = false;
+
 	// This is global to avoid similar generated name when retrieved from archive
 	static int32 Counter;
 };
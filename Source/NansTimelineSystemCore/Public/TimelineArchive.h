@@ -0,0 +1,96 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/ArchiveProxy.h"
+
+/** The versions of the FNTimeline::Archive() format */
+enum class ENTimelineArchiveVersion : int32
+{
+	/** Saves without header, UIDs are strings and labels are written for each event */
+	Legacy = 0,
+
+	/** A header with counts, a labels table, binary UIDs and optionally packed times */
+	Compact = 1,
+
+	/** Packed times are 64 bits varints, an int32 of milliseconds overflows after 24.8 days */
+	PackedTimes64 = 2,
+
+	/** PackedTimes64 + the offsets of expired records, they are read only when they are accessed */
+	IndexedExpiredEvents = 3,
+
+	/** IndexedExpiredEvents + the timeline clock is saved as a double, its precision is kept on long timelines */
+	DoubleClockTime = 4,
+
+	Latest = DoubleClockTime,
+};
+
+/**
+ * The archive FNTimeline uses to write its events records.
+ * It writes FNames as indexes of a labels table and can pack times as varints.
+ * @see INEvent::ArchiveRecord()
+ */
+class NANSTIMELINESYSTEMCORE_API FNTimelineArchive : public FArchiveProxy
+{
+public:
+	/** The key of the ENTimelineArchiveVersion custom version set on the archives given to FNTimeline::Archive() */
+	static const FGuid VersionGUID;
+
+	/** Written first by FNTimeline::Archive() to recognize legacy saves, which start with the timeline label. */
+	static const uint32 Magic;
+
+	/**
+	 * @param InInnerArchive - The archive of the records
+	 * @param InNames - The labels table, filled while saving and read while loading
+	 * @param bInPackedTimes - Times are rounded to the millisecond and written as varints
+	 * @param InVersion - The ENTimelineArchiveVersion of the records, it tells how packed times are written
+	 */
+	FNTimelineArchive(FArchive& InInnerArchive, TArray<FName>& InNames, const bool& bInPackedTimes,
+		const int32& InVersion = static_cast<int32>(ENTimelineArchiveVersion::Latest));
+
+	// BEGIN FArchive overrides
+	virtual FArchive& operator<<(FName& Value) override;
+	virtual FString GetArchiveName() const override;
+	// END FArchive overrides
+
+	/** Serializes a time in secs, -1 (not started, not expired) is exact in both modes */
+	void SerializeTime(float& Time);
+
+	/** Same as SerializeTime(), packed times are written as the delta from the previous record attached time */
+	void SerializeAttachedTime(float& Time);
+
+	/** Makes the next record readable without the previous ones. @see SerializeAttachedTime() */
+	void ResetDeltas();
+
+private:
+	TArray<FName>& Names;
+	TMap<FName, int32> NameIndexes;
+	bool bPackedTimes = false;
+	int32 Version = static_cast<int32>(ENTimelineArchiveVersion::Latest);
+
+	/** In milliseconds, @see SerializeAttachedTime() */
+	int64 PreviousAttachedTime = 0;
+
+	/**
+	 * Writes a signed int as a zigzag varint, on 64 bits since ENTimelineArchiveVersion::PackedTimes64.
+	 * Older versions are written on 32 bits, the value is clamped to fit.
+	 */
+	void SerializePackedInt(int64& Value);
+
+	/** @returns Time rounded to the millisecond */
+	static int64 ToMilliseconds(const float& Time);
+};
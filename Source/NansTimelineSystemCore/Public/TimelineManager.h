@@ -16,6 +16,7 @@
 
 #include "CoreMinimal.h"
 
+#include "Containers/Queue.h"
 #include "Timeline.h"
 
 class INEvent;
@@ -28,6 +29,31 @@ enum class ENTimelineTimerState : uint8
 	Stopped
 };
 
+class FNTimelineManager;
+
+/** A timeline to tick with FNTimelineManager::TickInParallel() */
+struct FNTimelineTickRequest
+{
+	FNTimelineTickRequest() {}
+	FNTimelineTickRequest(FNTimelineManager* InManager, const float& InDeltaTime)
+		: Manager(InManager), DeltaTime(InDeltaTime) {}
+
+	FNTimelineManager* Manager = nullptr;
+	float DeltaTime = 0.f;
+};
+
+/** An event attachment queued from any thread. @see FNTimelineManager::EnqueueNewEvent(), FNTimelineManager::EnqueueAttach() */
+struct FNTimelineEventRequest
+{
+	/** Attached as is when valid, otherwise an event is created with the fields below */
+	TSharedPtr<INEvent> Event;
+
+	FName Label;
+	FGuid UID;
+	float Duration = 0.f;
+	float Delay = 0.f;
+};
+
 /**
  * This class is the client for the NTimelineInterface object.
  * Its goal is to decoupled client interface with timeline management.
@@ -67,6 +93,41 @@ public:
 	/** This checks the actual play state (ENTimelineTimerState) and tick the NTimelineInterface accordingly. */
 	virtual void TimerTick(const float& InDeltaTime);
 
+	/**
+	 * Same as TimerTick() but it catches up with a long delta at once, instead of ticking every interval.
+	 * @see FNTimeline::AdvanceBy()
+	 */
+	virtual void AdvanceBy(const float& InDeltaTime, const FNTimelineAdvancePolicy& Policy = FNTimelineAdvancePolicy());
+
+	/**
+	 * Queues a long delta to be replayed tick by tick with CatchUp(), so it can be spread across frames.
+	 * The timeline reports it is catching up until the whole backlog has been replayed.
+	 * While it is catching up, the frame deltas should be queued here too instead of calling TimerTick(), to keep times ordered.
+	 *
+	 * @param InDeltaTime - The time to add to the backlog, in secs
+	 */
+	virtual void StartCatchUp(const float& InDeltaTime);
+
+	/**
+	 * Replays ticks of the catch-up backlog within the budget, it is meant to be called once per frame.
+	 * Handlers are notified exactly as with TimerTick(), once per tick interval.
+	 *
+	 * @param Budget - The max ticks or time this call can spend
+	 * @returns true when there is nothing left to catch up with
+	 */
+	virtual bool CatchUp(const FNTimelineCatchUpBudget& Budget);
+
+	/**
+	 * Same as calling TimerTick() on each manager, but the timelines are ticked in parallel.
+	 * The hooks (OnValidateTimelineTick()...) and every delegates are called on the calling thread:
+	 * notifications are collected during the parallel part, then broadcast manager by manager in the requests order.
+	 * Expired slots are released after their notifications, as in TimerTick(), so their Index is valid and they can be pooled.
+	 * Timelines can't share events, and an event stopped by a listener is only seen at the next tick.
+	 *
+	 * @param Requests - The managers to tick with their delta, each manager only once
+	 */
+	static void TickInParallel(const TArray<FNTimelineTickRequest>& Requests);
+
 	/** Get the actual state. */
 	ENTimelineTimerState GetState() const;
 
@@ -79,13 +140,56 @@ public:
 	* @param Name - The label of the event, can be useful for user stats & feedback
 	* @param Duration - The time this event is active, 0 to almost INFINI (0 means undetermined time)
 	* @param Delay - The time before this event start being active, 0 to almost INFINI (0 means "right now")
+	* @param UID - (optional) a new one is generated if it is not valid
 	*/
 	virtual TSharedPtr<INEvent> CreateNewEvent(const FName& Name, const float& Duration = 0.f,
-		const float& Delay = 0.f) const;
+		const float& Delay = 0.f, const FGuid& UID = FGuid()) const;
+
+	/**
+	 * Thread safe: queues the creation of an event, which is attached at the start of the next tick
+	 * (TimerTick(), AdvanceBy()...) before OnNotifyTimelineTickBefore(), or by DrainSubmissions().
+	 * Requests of one thread are attached in their order.
+	 *
+	 * @param Name - @see CreateNewEvent()
+	 * @param Duration - @see CreateNewEvent()
+	 * @param Delay - @see CreateNewEvent()
+	 * @returns the UID the event will have
+	 */
+	FGuid EnqueueNewEvent(const FName& Name, const float& Duration = 0.f, const float& Delay = 0.f);
+
+	/**
+	 * Thread safe: queues an event which is attached the same way as EnqueueNewEvent() ones.
+	 * The calling thread should not keep any reference to it, references counts of events are not thread safe.
+	 */
+	void EnqueueAttach(TSharedPtr<INEvent>&& Event);
+
+	/**
+	 * Attaches the queued events now, it should only be called by the thread which ticks this manager.
+	 * @returns the number of attached events
+	 */
+	int32 DrainSubmissions();
 
 	/** @returns a FNTimelineEventDelegate ref which is broadcast when an event changes. */
 	FNTimelineEventDelegate& OnEventChanged() const;
 
+	/**
+	 * @returns a FNTimelineEventBatchDelegate ref which is broadcast once per tick with all the notifications of this type.
+	 * Unlike OnEventChanged(), it can't be used to prevent an event to be attached (ENTimelineEvent::BeforeAttached).
+	 */
+	FNTimelineEventBatchDelegate& OnEventsChanged(const ENTimelineEvent& EventName) const;
+
+	/**
+	 * @returns a FNTimelineEventEvictedDelegate ref which is broadcast when an expired event leaves the timeline history,
+	 * or when it is pooled instead of entering it. @see FNTimeline::SetPoolCapacity()
+	 */
+	FNTimelineEventEvictedDelegate& OnExpiredEventEvicted() const;
+
+	/** @returns a FNTimelineCatchUpProgressDelegate ref which is broadcast after each CatchUp() call. */
+	FNTimelineCatchUpProgressDelegate& OnCatchUpProgressed() const;
+
+	/** @returns a FNTimelineCatchUpCompletedDelegate ref which is broadcast when the catch-up backlog is empty. */
+	FNTimelineCatchUpCompletedDelegate& OnCatchUpCompleted() const;
+
 	/**
 	 * Gives the opportunity to clean data.
 	 * This calls Timeline::Clear()
@@ -111,6 +215,16 @@ protected:
 	/** This method is call immediately after ticking */
 	virtual void OnNotifyTimelineTickAfter(const float& InDeltaTime) {}
 
+	/**
+	 * Attaches a queued event, called by DrainSubmissions() on the ticking thread.
+	 * Override it to wrap the event before it is attached.
+	 * @returns true if the event has been attached
+	 */
+	virtual bool AttachSubmission(const TSharedPtr<INEvent>& Event);
+
 	/** The coupled timeline */
 	TSharedRef<FNTimeline> Timeline;
+
+	/** Lock free, filled by any thread and drained by the ticking one. @see EnqueueNewEvent() */
+	TQueue<FNTimelineEventRequest, EQueueMode::Mpsc> Submissions;
 };
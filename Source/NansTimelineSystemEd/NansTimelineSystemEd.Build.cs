@@ -40,6 +40,7 @@ namespace UnrealBuildTool.Rules
 					"DetailCustomizations",
 					"AssetTools",
 					"Projects",
+					"DesktopPlatform",
 					"NansCoreHelpers",
 					"NansUE4TestsHelpers",
 					"NansTimelineSystemCore",
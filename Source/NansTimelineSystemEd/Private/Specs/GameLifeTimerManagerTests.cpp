@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "CoreMinimal.h"
+#include "Async/Async.h"
 #include "Engine/DebugCameraController.h"
 #include "Engine/Engine.h"
 #include "Engine/EngineTypes.h"
@@ -23,6 +24,7 @@
 #include "NansUE4TestsHelpers/Public/Mock/FakeObject.h"
 #include "Runtime/Engine/Classes/Kismet/GameplayStatics.h"
 #include "Serialization/BufferArchive.h"
+#include "Event/EventBase.h"
 
 // TODO make specs instead of these
 // @formatter:off
@@ -224,3 +226,112 @@ bool FGameLifeTimelineManagerSerializationWithEventsTest::RunTest(const FString&
 	UE_LOG(LogTemp, Display, TEXT("2- Test run on %f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.f);
 	return true;
 }
+
+// @formatter:off
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameLifeTimelineManagerLazyExpiredEventsTest,
+"Nans.TimelineSystem.UE4.GameLifeTimelineManager.Test.ShouldReadExpiredEventsOnlyWhenTheyAreAccessed", EAutomationTestFlags::EditorContext |
+EAutomationTestFlags::EngineFilter)
+// @formatter:on
+bool FGameLifeTimelineManagerLazyExpiredEventsTest::RunTest(const FString& Parameters)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	UWorld* World = NTestWorld::CreateAndPlay(EWorldType::Game, true);
+	// RF_MarkAsRootSet to avoid deletion when GC passes
+	UFakeObject* FakeObject = NewObject<UFakeObject>(World, FName("MyFakeObject"), EObjectFlags::RF_MarkAsRootSet);
+	FakeObject->SetMyWorld(World);
+	UNGameLifeTimelineManager* TimelineManager = FNTimelineManagerDecoratorFactory::CreateObject<
+		UNGameLifeTimelineManager>(FakeObject, 1.f, FName("TestTimeline"), EObjectFlags::RF_MarkAsRootSet);
+	TimelineManager->Play();
+
+	// Begin test
+	{
+		TArray<FGuid> UIDs;
+		for (int32 Idx = 0; Idx < 3; Idx++)
+		{
+			UIDs.Add(TimelineManager->CreateAndAddNewEvent(FName("Short", Idx), nullptr, 1.f)->GetGUID());
+		}
+		TimelineManager->TimerTick(1.f);
+		TimelineManager->TimerTick(1.f);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("All events are expired"), TimelineManager->GetExpiredEvents().Num(), 3);
+
+		FBufferArchive ToBinary;
+		TimelineManager->Serialize(ToBinary);
+		UNGameLifeTimelineManager* NewTimelineManager = FNTimelineManagerDecoratorFactory::CreateObject<
+			UNGameLifeTimelineManager>(FakeObject, 1.f, FName("DiffTimelineLabel"), EObjectFlags::RF_MarkAsRootSet);
+		FMemoryReader FromBinary = FMemoryReader(ToBinary, true);
+		NewTimelineManager->Serialize(FromBinary);
+
+		const TSharedPtr<FNTimeline> Timeline = NewTimelineManager->GetTimeline();
+		bool bIsAnyResolved = false;
+		for (const FGuid& UID : UIDs)
+		{
+			bIsAnyResolved |= Timeline->IsExpiredEventResolved(UID);
+		}
+		TEST_FALSE(TEST_TEXT_FN_DETAILS("No expired record is read by the load"), bIsAnyResolved);
+
+		const UNEventBase* EventBase = NewTimelineManager->GetExpiredEvent(UIDs[1]);
+		TEST_TRUE(TEST_TEXT_FN_DETAILS("The expired event is found"), IsValid(EventBase));
+		TEST_EQ(TEST_TEXT_FN_DETAILS("The expired event has its core event"), EventBase->GetEventLabel(), FName("Short", 1));
+		TEST_TRUE(TEST_TEXT_FN_DETAILS("Its record has been read"), Timeline->IsExpiredEventResolved(UIDs[1]));
+		TEST_FALSE(TEST_TEXT_FN_DETAILS("The other records are not read"), Timeline->IsExpiredEventResolved(UIDs[0]));
+		TEST_EQ(TEST_TEXT_FN_DETAILS("All expired events are loaded"), NewTimelineManager->GetExpiredEvents().Num(), 3);
+		TEST_TRUE(TEST_TEXT_FN_DETAILS("All records are read once listed"), Timeline->IsExpiredEventResolved(UIDs[0]));
+	}
+	// End test
+
+	NTestWorld::Destroy(World);
+	UE_LOG(LogTemp, Display, TEXT("2- Test run on %f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.f);
+	return true;
+}
+
+// @formatter:off
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameLifeTimelineManagerQueuedEventsTest,
+"Nans.TimelineSystem.UE4.GameLifeTimelineManager.Test.ShouldWrapEventsQueuedFromAnyThread", EAutomationTestFlags::EditorContext |
+EAutomationTestFlags::EngineFilter)
+// @formatter:on
+bool FGameLifeTimelineManagerQueuedEventsTest::RunTest(const FString& Parameters)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	UWorld* World = NTestWorld::CreateAndPlay(EWorldType::Game, true);
+	// RF_MarkAsRootSet to avoid deletion when GC passes
+	UFakeObject* FakeObject = NewObject<UFakeObject>(World, FName("MyFakeObject"), EObjectFlags::RF_MarkAsRootSet);
+	FakeObject->SetMyWorld(World);
+	UNGameLifeTimelineManager* TimelineManager = FNTimelineManagerDecoratorFactory::CreateObject<
+		UNGameLifeTimelineManager>(FakeObject, 1.f, FName("TestTimeline"), EObjectFlags::RF_MarkAsRootSet);
+	TimelineManager->Play();
+
+	// Begin test
+	{
+		const int32 NumEvents = 100;
+		TFuture<TArray<FGuid>> Producer = Async(EAsyncExecution::Thread, [TimelineManager, NumEvents]()
+		{
+			TArray<FGuid> UIDs;
+			for (int32 Idx = 0; Idx < NumEvents; Idx++)
+			{
+				UIDs.Add(TimelineManager->EnqueueNewEvent(FName("Queued", Idx), Idx % 2 == 0 ? 1.f : 0.f));
+			}
+			return UIDs;
+		});
+		const TArray<FGuid> UIDs = Producer.Get();
+		TEST_EQ(TEST_TEXT_FN_DETAILS("Queued events are not attached before the tick"), TimelineManager->GetEvents().Num(), 0);
+
+		TimelineManager->TimerTick(1.f);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("Queued events are attached at the tick"), TimelineManager->GetTimeline()->GetEvents().Num() + TimelineManager->GetTimeline()->GetExpiredEvents().Num(), NumEvents);
+		bool bAreWrapped = true;
+		for (const FGuid& UID : UIDs)
+		{
+			bAreWrapped &= IsValid(TimelineManager->GetEvent(UID)) || IsValid(TimelineManager->GetExpiredEvent(UID));
+		}
+		TEST_TRUE(TEST_TEXT_FN_DETAILS("Each queued event has its UNEventBase"), bAreWrapped);
+
+		// The events with a duration expire through the decorator, as the ones created on the game thread
+		TimelineManager->TimerTick(1.f);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("Expired queued events are kept"), TimelineManager->GetExpiredEvents().Num(), NumEvents / 2);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("Endless queued events are still alive"), TimelineManager->GetEvents().Num(), NumEvents / 2);
+	}
+	// End test
+
+	NTestWorld::Destroy(World);
+	UE_LOG(LogTemp, Display, TEXT("2- Test run on %f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.f);
+	return true;
+}
@@ -17,6 +17,7 @@
 #include "Engine/EngineTypes.h"
 #include "Misc/AutomationTest.h"
 #include "NansTimelineSystemUE4/Public/Manager/RealLifeTimelineManager.h"
+#include "NansTimelineSystemUE4/Public/TimelineTickDriver.h"
 #include "NansUE4TestsHelpers/Public/Helpers/Assertions.h"
 #include "NansUE4TestsHelpers/Public/Helpers/TestWorld.h"
 #include "NansUE4TestsHelpers/Public/Mock/FakeObject.h"
@@ -345,3 +346,107 @@ bool FRealLifeTimelineManagerEventTest::RunTest(const FString& Parameters)
 	UE_LOG(LogTemp, Display, TEXT("2- Test run on %f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.f);
 	return true;
 }
+
+// @formatter:off
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealLifeTimelineManagerClockSourceTest,
+"Nans.TimelineSystem.UE4.RealLifeTimelineManager.Test.ShouldTickWithItsClockSourceWithoutLosingTime", EAutomationTestFlags::EditorContext |
+EAutomationTestFlags::EngineFilter)
+// @formatter:on
+bool FRealLifeTimelineManagerClockSourceTest::RunTest(const FString& Parameters)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	UWorld* World = NTestWorld::CreateAndPlay(EWorldType::Game, true);
+	// RF_MarkAsRootSet to avoid deletion when GC passes
+	UFakeObject* FakeObject = NewObject<UFakeObject>(World, FName("MyFakeObject"), EObjectFlags::RF_MarkAsRootSet);
+	FakeObject->SetMyWorld(World);
+	UNRealLifeTimelineManager* TimelineManager = FNTimelineManagerDecoratorFactory::CreateObject<
+		UNRealLifeTimelineManager>(
+		FakeObject,
+		1.f,
+		FName("TestTimeline"),
+		EObjectFlags::RF_MarkAsRootSet
+	);
+	TSharedRef<FNTestClockSource> Clock = MakeShared<FNTestClockSource>();
+	TimelineManager->SetClockSource(Clock);
+
+	// Begin test
+	{
+		Clock->Advance(0.6);
+		NTestWorld::Tick(World);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("Not ticked under the tick interval"), TimelineManager->GetCurrentTime(), 0.f);
+		Clock->Advance(0.6);
+		NTestWorld::Tick(World);
+		TEST_TRUE(
+			TEST_TEXT_FN_DETAILS("The time of both frames is ticked"),
+			FMath::IsNearlyEqual(TimelineManager->GetCurrentTime(), 1.2f)
+		);
+		for (int32 Frame = 0; Frame < 600; Frame++)
+		{
+			Clock->Advance(1. / 60.);
+			NTestWorld::Tick(World);
+		}
+		TEST_TRUE(
+			TEST_TEXT_FN_DETAILS("No time is lost between frames"),
+			FMath::IsNearlyEqual(TimelineManager->GetCurrentTime(), 11.2f, 1.f)
+		);
+	}
+	// End test
+
+	NTestWorld::Destroy(World);
+	UE_LOG(LogTemp, Display, TEXT("2- Test run on %f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.f);
+	return true;
+}
+
+// @formatter:off
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealLifeTimelineManagerTickDriverTest,
+"Nans.TimelineSystem.UE4.RealLifeTimelineManager.Test.ShouldBeTickedOnceByASharedTickDriver", EAutomationTestFlags::EditorContext |
+EAutomationTestFlags::EngineFilter)
+// @formatter:on
+bool FRealLifeTimelineManagerTickDriverTest::RunTest(const FString& Parameters)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	UWorld* World = NTestWorld::CreateAndPlay(EWorldType::Game, true);
+	// RF_MarkAsRootSet to avoid deletion when GC passes
+	UFakeObject* FakeObject = NewObject<UFakeObject>(World, FName("MyFakeObject"), EObjectFlags::RF_MarkAsRootSet);
+	FakeObject->SetMyWorld(World);
+	UNTimelineTickDriver* TickDriver = NewObject<UNTimelineTickDriver>(FakeObject, NAME_None, EObjectFlags::RF_MarkAsRootSet);
+	TArray<UNRealLifeTimelineManager*> Managers;
+	TArray<TSharedRef<FNTestClockSource>> Clocks;
+	for (const float& TickInterval : {2.f, 1.f, 1.f})
+	{
+		UNRealLifeTimelineManager* Manager = FNTimelineManagerDecoratorFactory::CreateObject<UNRealLifeTimelineManager>(
+			FakeObject,
+			TickInterval,
+			NAME_None,
+			EObjectFlags::RF_MarkAsRootSet
+		);
+		TSharedRef<FNTestClockSource> Clock = MakeShared<FNTestClockSource>();
+		Manager->SetClockSource(Clock);
+		TickDriver->Register(Manager);
+		Managers.Add(Manager);
+		Clocks.Add(Clock);
+	}
+
+	// Begin test
+	{
+		TEST_EQ(TEST_TEXT_FN_DETAILS("3 managers are driven"), TickDriver->Num(), 3);
+		TEST_FALSE(TEST_TEXT_FN_DETAILS("A driven manager is not tickable by itself"), Managers[0]->IsTickable());
+		for (const TSharedRef<FNTestClockSource>& Clock : Clocks)
+		{
+			Clock->Advance(1.5);
+		}
+		NTestWorld::Tick(World);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("Under its tick interval"), Managers[0]->GetCurrentTime(), 0.f);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("Ticked once by the driver"), Managers[1]->GetCurrentTime(), 1.5f);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("Ticked once by the driver"), Managers[2]->GetCurrentTime(), 1.5f);
+
+		TickDriver->Unregister(Managers[1]);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("2 managers are driven"), TickDriver->Num(), 2);
+		TEST_TRUE(TEST_TEXT_FN_DETAILS("It ticks by itself again"), Managers[1]->IsTickable());
+	}
+	// End test
+
+	NTestWorld::Destroy(World);
+	UE_LOG(LogTemp, Display, TEXT("2- Test run on %f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.f);
+	return true;
+}
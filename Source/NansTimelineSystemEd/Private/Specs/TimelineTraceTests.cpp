@@ -0,0 +1,158 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "NansUE4TestsHelpers/Public/Helpers/Assertions.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Trace/TimelineTrace.h"
+#include "UI/SNTimeline.h"
+
+/** Records the lifecycle of NumEvents events of 2 labels, a new event is attached every 0.1 sec. */
+static void FillTrace(FNTimelineTrace& Trace, const int32& NumEvents)
+{
+	const int32 LabelIndexes[] = {Trace.InternLabel(TEXT("Fire")), Trace.InternLabel(TEXT("Poison"))};
+	for (int32 Idx = 0; Idx < NumEvents; Idx++)
+	{
+		FNTimelineTraceRecord Record;
+		Record.UID = FGuid::NewGuid();
+		Record.Time = Idx * 0.1f;
+		Record.Duration = 1.f + Idx % 7;
+		Record.Delay = Idx % 2 == 0 ? 0.f : 0.5f;
+		Record.LabelIndex = LabelIndexes[Idx % 2];
+		Record.Color = FColor::Red;
+		Record.EventName = ENTimelineEvent::AfterAttached;
+		Trace.Add(Record);
+
+		Record.Time += Record.Delay;
+		Record.EventName = ENTimelineEvent::Start;
+		Trace.Add(Record);
+
+		Record.Time += Record.Duration;
+		Record.EventName = ENTimelineEvent::Expired;
+		Trace.Add(Record);
+	}
+}
+
+// @formatter:off
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimelineTraceDropTest, "Nans.TimelineSystem.UE4.TimelineTrace.Test.ShouldDropTheOldestRecordsWhenFull",
+EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+// @formatter:on
+bool FTimelineTraceDropTest::RunTest(const FString& Parameters)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	FNTimelineTrace Trace(30);
+
+	// Begin test
+	{
+		FillTrace(Trace, 12);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("The trace keeps its capacity"), Trace.Num(), 30);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("The 2 first events have been dropped"), Trace.GetNumDropped(), 6);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("The oldest record is the 3rd attachment"), Trace[0].Time, 0.2f);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("Labels are interned once"), Trace.GetLabel(Trace[0].LabelIndex), FName(TEXT("Fire")));
+
+		FTimelineData Data;
+		SNTimeline::LayOutTrace(Trace, Data);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("Only the recorded events are laid out"), Data.SlotIndexes.Num(), 10);
+	}
+	// End test
+
+	UE_LOG(LogTemp, Display, TEXT("2- Test run on %f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.f);
+	return true;
+}
+
+// @formatter:off
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimelineTraceSerializationTest, "Nans.TimelineSystem.UE4.TimelineTrace.Test.ShouldSaveAndLoadTheRecords",
+EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+// @formatter:on
+bool FTimelineTraceSerializationTest::RunTest(const FString& Parameters)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	FNTimelineTrace Trace(30);
+	Trace.TimelineName = TEXT("Game");
+	FillTrace(Trace, 12);
+
+	// Begin test
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		Trace.Serialize(Writer);
+
+		FNTimelineTrace Loaded;
+		FMemoryReader Reader(Bytes);
+		Loaded.Serialize(Reader);
+
+		TEST_EQ(TEST_TEXT_FN_DETAILS("The timeline name is loaded"), Loaded.TimelineName, Trace.TimelineName);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("The records are loaded"), Loaded.Num(), Trace.Num());
+		TEST_EQ(TEST_TEXT_FN_DETAILS("The dropped records are counted"), Loaded.GetNumDropped(), Trace.GetNumDropped());
+		TEST_EQ(TEST_TEXT_FN_DETAILS("The duration is loaded"), Loaded.GetDuration(), Trace.GetDuration());
+		bool bAreSame = true;
+		for (int32 Idx = 0; Idx < Trace.Num(); Idx++)
+		{
+			bAreSame &= Loaded[Idx].UID == Trace[Idx].UID && Loaded[Idx].Time == Trace[Idx].Time
+				&& Loaded[Idx].Duration == Trace[Idx].Duration && Loaded[Idx].Delay == Trace[Idx].Delay
+				&& Loaded[Idx].Color == Trace[Idx].Color && Loaded[Idx].EventName == Trace[Idx].EventName
+				&& Loaded.GetLabel(Loaded[Idx].LabelIndex) == Trace.GetLabel(Trace[Idx].LabelIndex);
+		}
+		TEST_TRUE(TEST_TEXT_FN_DETAILS("The records are the same in the same order"), bAreSame);
+
+		// The loaded trace keeps its capacity
+		FNTimelineTraceRecord Record = Trace[0];
+		Loaded.Add(Record);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("The loaded trace drops the oldest record too"), Loaded.GetNumDropped(), Trace.GetNumDropped() + 1);
+	}
+	// End test
+
+	UE_LOG(LogTemp, Display, TEXT("2- Test run on %f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.f);
+	return true;
+}
+
+// @formatter:off
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimelineTraceMillionRecordsTest, "Nans.TimelineSystem.UE4.TimelineTrace.Test.ShouldLoadAndLayOutAMillionRecords",
+EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+// @formatter:on
+bool FTimelineTraceMillionRecordsTest::RunTest(const FString& Parameters)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 NumEvents = 1000000 / 3 + 1;
+	FNTimelineTrace Trace;
+	FillTrace(Trace, NumEvents);
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Trace.Serialize(Writer);
+
+	// Begin test
+	{
+		const double LoadStartTime = FPlatformTime::Seconds();
+		FNTimelineTrace Loaded;
+		FMemoryReader Reader(Bytes);
+		Loaded.Serialize(Reader);
+		const double LayOutStartTime = FPlatformTime::Seconds();
+		FTimelineData Data;
+		SNTimeline::LayOutTrace(Loaded, Data);
+		const double EndTime = FPlatformTime::Seconds();
+
+		TEST_TRUE(TEST_TEXT_FN_DETAILS("A million records are loaded"), Loaded.Num() >= 1000000);
+		TEST_EQ(TEST_TEXT_FN_DETAILS("Every event is laid out"), Data.SlotIndexes.Num(), NumEvents);
+		TEST_TRUE(TEST_TEXT_FN_DETAILS("Slots of a row don't overlap"), Data.Rows[0].Slots.Num() > 1
+			&& Data.Rows[0].Slots[0].GetEnd(0.f) <= Data.Rows[0].Slots[1].GetStart());
+		UE_LOG(LogTemp, Display, TEXT("[ BENCH    ] %d records (%d bytes): loaded in %f ms, laid out in %f ms"),
+			Loaded.Num(), Bytes.Num(), (LayOutStartTime - LoadStartTime) * 1000.f, (EndTime - LayOutStartTime) * 1000.f);
+	}
+	// End test
+
+	UE_LOG(LogTemp, Display, TEXT("2- Test run on %f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.f);
+	return true;
+}
@@ -0,0 +1,185 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "Trace/TimelineTrace.h"
+
+#include "HAL/FileManager.h"
+
+const TCHAR* FNTimelineTrace::FileExtension = TEXT("ntrace");
+constexpr int32 FNTimelineTrace::DefaultCapacity;
+constexpr uint32 FNTimelineTrace::FileMagic;
+constexpr int32 FNTimelineTrace::FileVersion;
+
+FArchive& operator<<(FArchive& Ar, FNTimelineTraceRecord& Record)
+{
+	uint8 EventName = static_cast<uint8>(Record.EventName);
+	Ar << Record.UID;
+	Ar << Record.Time;
+	Ar << Record.Duration;
+	Ar << Record.Delay;
+	Ar << Record.LabelIndex;
+	Ar << Record.Color;
+	Ar << EventName;
+	Ar.Serialize(Record.Padding, sizeof(Record.Padding));
+	Record.EventName = static_cast<ENTimelineEvent>(EventName);
+	return Ar;
+}
+
+FNTimelineTrace::FNTimelineTrace(const int32& InCapacity) : Capacity(FMath::Max(InCapacity, 1)) {}
+
+void FNTimelineTrace::Add(const FNTimelineTraceRecord& Record)
+{
+	if (Records.Num() >= Capacity)
+	{
+		Records.PopFirst();
+		NumDropped++;
+	}
+	Records.Add(FNTimelineTraceRecord(Record));
+	Duration = FMath::Max(Duration, Record.Time);
+}
+
+int32 FNTimelineTrace::InternLabel(const FName& Label)
+{
+	if (const int32* Index = LabelIndexes.Find(Label))
+	{
+		return *Index;
+	}
+	const int32 Index = Labels.Add(Label);
+	LabelIndexes.Add(Label, Index);
+	return Index;
+}
+
+FName FNTimelineTrace::GetLabel(const int32& Index) const
+{
+	return Labels.IsValidIndex(Index) ? Labels[Index] : NAME_None;
+}
+
+int32 FNTimelineTrace::Num() const
+{
+	return Records.Num();
+}
+
+const FNTimelineTraceRecord& FNTimelineTrace::operator[](const int32& Index) const
+{
+	return Records[Index];
+}
+
+float FNTimelineTrace::GetDuration() const
+{
+	return Duration;
+}
+
+int32 FNTimelineTrace::GetNumDropped() const
+{
+	return NumDropped;
+}
+
+void FNTimelineTrace::Empty()
+{
+	Records.Empty();
+	Labels.Empty();
+	LabelIndexes.Empty();
+	NumDropped = 0;
+	Duration = 0.f;
+}
+
+void FNTimelineTrace::Serialize(FArchive& Ar)
+{
+	FString Name = TimelineName.ToString();
+	int32 SavedCapacity = Capacity;
+	int32 SavedNumDropped = NumDropped;
+	Ar << Name;
+	Ar << SavedCapacity;
+	Ar << SavedNumDropped;
+
+	// FName can't be serialized by a file archive
+	TArray<FString> LabelNames;
+	if (Ar.IsSaving())
+	{
+		for (const FName& Label : Labels)
+		{
+			LabelNames.Add(Label.ToString());
+		}
+	}
+	Ar << LabelNames;
+
+	// Records are contiguous in the archive so they are read at once
+	TArray<FNTimelineTraceRecord> Items;
+	if (Ar.IsSaving())
+	{
+		Items.Reserve(Records.Num());
+		for (int32 Idx = 0; Idx < Records.Num(); Idx++)
+		{
+			Items.Add(Records[Idx]);
+		}
+	}
+	Items.BulkSerialize(Ar);
+
+	if (Ar.IsLoading() && !Ar.IsError())
+	{
+		Empty();
+		TimelineName = FName(*Name);
+		Capacity = FMath::Max3(SavedCapacity, Items.Num(), 1);
+		NumDropped = SavedNumDropped;
+		for (const FString& LabelName : LabelNames)
+		{
+			InternLabel(FName(*LabelName));
+		}
+		Records.Reserve(Items.Num());
+		for (FNTimelineTraceRecord& Item : Items)
+		{
+			Duration = FMath::Max(Duration, Item.Time);
+			Records.Add(MoveTemp(Item));
+		}
+	}
+}
+
+bool FNTimelineTrace::SaveToFile(const FString& Filename)
+{
+	const TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!Ar.IsValid())
+	{
+		return false;
+	}
+
+	uint32 Magic = FileMagic;
+	int32 Version = FileVersion;
+	*Ar << Magic;
+	*Ar << Version;
+	Serialize(*Ar);
+	return Ar->Close();
+}
+
+TSharedPtr<FNTimelineTrace> FNTimelineTrace::LoadFromFile(const FString& Filename)
+{
+	const TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileReader(*Filename));
+	if (!Ar.IsValid())
+	{
+		return nullptr;
+	}
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	*Ar << Magic;
+	*Ar << Version;
+	if (Magic != FileMagic || Version != FileVersion)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FNTimelineTrace> Trace = MakeShared<FNTimelineTrace>();
+	Trace->Serialize(*Ar);
+	return Ar->IsError() ? nullptr : Trace;
+}
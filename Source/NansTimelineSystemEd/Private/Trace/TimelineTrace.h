@@ -0,0 +1,120 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "RingBuffer.h"
+#include "Timeline.h"
+
+/** One event notification recorded in a FNTimelineTrace, every record has the same size. */
+struct FNTimelineTraceRecord
+{
+	/** The event notified */
+	FGuid UID;
+	/** The time of the timeline when it has been notified */
+	float Time = 0.f;
+	/** @see INEvent::GetDuration() */
+	float Duration = 0.f;
+	/** @see INEvent::GetDelay() */
+	float Delay = 0.f;
+	/** The index of the event label in FNTimelineTrace labels, @see FNTimelineTrace::GetLabel() */
+	int32 LabelIndex = INDEX_NONE;
+	/** @see UNEventBase::GetDebugColor() */
+	FColor Color = FColor::White;
+	/** AfterAttached, Start or Expired */
+	ENTimelineEvent EventName = ENTimelineEvent::AfterAttached;
+	/**
+	 * Records are loaded by copying their memory (TArray::BulkSerialize) but saved with operator<<,
+	 * so every byte of the struct is serialized, the padding included.
+	 */
+	uint8 Padding[3] = {0, 0, 0};
+
+	friend FArchive& operator<<(FArchive& Ar, FNTimelineTraceRecord& Record);
+};
+
+static_assert(
+	sizeof(FNTimelineTraceRecord) == sizeof(FGuid) + 3 * sizeof(float) + sizeof(int32) + sizeof(FColor) + 4,
+	"FNTimelineTraceRecord must not have implicit padding, operator<< has to write sizeof(FNTimelineTraceRecord) bytes"
+);
+
+/**
+ * The recorded notifications of a timeline, in the order they have been notified.
+ * Records are kept in a ring buffer: when it is full, the oldest ones are dropped.
+ * Labels are interned, a record only keeps an index.
+ *
+ * @see FNTimelineTraceRecorder
+ */
+class FNTimelineTrace
+{
+public:
+	/** The default max number of records */
+	static constexpr int32 DefaultCapacity = 1 << 20;
+
+	/** The extension of the trace files */
+	static const TCHAR* FileExtension;
+
+	explicit FNTimelineTrace(const int32& InCapacity = DefaultCapacity);
+
+	/** The name of the recorded timeline */
+	FName TimelineName = NAME_None;
+
+	/** Adds a record after the last one, the oldest is dropped if the trace is full. */
+	void Add(const FNTimelineTraceRecord& Record);
+
+	/** @returns the index of this label, it is added the first time. */
+	int32 InternLabel(const FName& Label);
+
+	/** @returns the label interned at this index or NAME_None */
+	FName GetLabel(const int32& Index) const;
+
+	/** @returns the number of records */
+	int32 Num() const;
+
+	/** @param Index - 0 is the oldest record */
+	const FNTimelineTraceRecord& operator[](const int32& Index) const;
+
+	/** @returns the time of the latest record */
+	float GetDuration() const;
+
+	/** @returns the number of records dropped since the trace is full */
+	int32 GetNumDropped() const;
+
+	/** Removes all records and labels. */
+	void Empty();
+
+	/** Saves or loads the records, the labels and the timeline name. */
+	void Serialize(FArchive& Ar);
+
+	/** @returns false if the file can't be written */
+	bool SaveToFile(const FString& Filename);
+
+	/** @returns nullptr if the file can't be read or is not a trace */
+	static TSharedPtr<FNTimelineTrace> LoadFromFile(const FString& Filename);
+
+private:
+	/** Identifies a trace file and its format */
+	static constexpr uint32 FileMagic = 0x4E54524E;
+	static constexpr int32 FileVersion = 2;
+
+	TNRingBuffer<FNTimelineTraceRecord> Records;
+	int32 Capacity = DefaultCapacity;
+	int32 NumDropped = 0;
+	/** Batches of different notifications can be in any order, @see GetDuration() */
+	float Duration = 0.f;
+	TArray<FName> Labels;
+	TMap<FName, int32> LabelIndexes;
+};
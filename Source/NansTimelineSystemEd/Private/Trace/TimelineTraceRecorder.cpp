@@ -0,0 +1,95 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "Trace/TimelineTraceRecorder.h"
+
+#include "Event/EventBase.h"
+#include "Manager/TimelineManagerDecorator.h"
+
+/** The notifications which are recorded */
+static const ENTimelineEvent RecordedEvents[] = {
+	ENTimelineEvent::AfterAttached, ENTimelineEvent::Start, ENTimelineEvent::Expired
+};
+
+FNTimelineTraceRecorder::~FNTimelineTraceRecorder()
+{
+	Stop();
+}
+
+void FNTimelineTraceRecorder::Start(UNTimelineManagerDecorator* InTimeline, const int32& Capacity)
+{
+	Stop();
+	if (!IsValid(InTimeline))
+	{
+		return;
+	}
+
+	Timeline = InTimeline;
+	Trace = MakeShared<FNTimelineTrace>(Capacity);
+	Trace->TimelineName = InTimeline->GetLabel();
+	for (const ENTimelineEvent& EventName : RecordedEvents)
+	{
+		InTimeline->OnEventsChanged(EventName).AddRaw(this, &FNTimelineTraceRecorder::OnEventsChanged);
+	}
+}
+
+void FNTimelineTraceRecorder::Stop()
+{
+	if (!Timeline.IsValid())
+	{
+		return;
+	}
+
+	for (const ENTimelineEvent& EventName : RecordedEvents)
+	{
+		Timeline->OnEventsChanged(EventName).RemoveAll(this);
+	}
+	Timeline.Reset();
+}
+
+bool FNTimelineTraceRecorder::IsRecording() const
+{
+	return Timeline.IsValid();
+}
+
+TSharedPtr<FNTimelineTrace> FNTimelineTraceRecorder::GetTrace() const
+{
+	return Trace;
+}
+
+void FNTimelineTraceRecorder::OnEventsChanged(TArrayView<const FNTimelineNotification> Notifications)
+{
+	for (const FNTimelineNotification& Notification : Notifications)
+	{
+		const TSharedPtr<INEvent>& Event = Notification.Event;
+		FNTimelineTraceRecord Record;
+		Record.UID = Event->GetGUID();
+		Record.Time = Notification.Time;
+		Record.Duration = Event->GetDuration();
+		Record.Delay = Event->GetDelay();
+		Record.LabelIndex = Trace->InternLabel(Event->GetEventLabel());
+		Record.EventName = Notification.EventName;
+
+		// The UNEventBase is only needed for its color, the decorator may not know it (pooled, attached from the core)
+		if (Notification.EventName == ENTimelineEvent::AfterAttached && Timeline.IsValid())
+		{
+			if (const UNEventBase* EventBase = Timeline->GetEvent(Record.UID))
+			{
+				Record.Color = EventBase->GetDebugColor();
+			}
+		}
+		Trace->Add(Record);
+	}
+}
@@ -0,0 +1,60 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Trace/TimelineTrace.h"
+
+class UNTimelineManagerDecorator;
+
+/**
+ * Records the lifecycle notifications (AfterAttached, Start, Expired) of a timeline in a FNTimelineTrace.
+ * The trace outlives the timeline, so it can be replayed after the game ends.
+ */
+class FNTimelineTraceRecorder
+{
+public:
+	/** Stops recording */
+	~FNTimelineTraceRecorder();
+
+	/**
+	 * Starts recording InTimeline in a new trace, the previous one is kept by its owners only.
+	 *
+	 * @param InTimeline - The timeline to record
+	 * @param Capacity - The max number of records, @see FNTimelineTrace
+	 */
+	void Start(UNTimelineManagerDecorator* InTimeline, const int32& Capacity = FNTimelineTrace::DefaultCapacity);
+
+	/** Stops listening the timeline, the trace is kept. */
+	void Stop();
+
+	/** @returns true if it listens to a living timeline */
+	bool IsRecording() const;
+
+	/** @returns the last recorded trace, nullptr if nothing has been recorded */
+	TSharedPtr<FNTimelineTrace> GetTrace() const;
+
+private:
+	/** Adds a record per notification */
+	void OnEventsChanged(TArrayView<const FNTimelineNotification> Notifications);
+
+	/** The recorded timeline */
+	TWeakObjectPtr<UNTimelineManagerDecorator> Timeline;
+
+	/** @see GetTrace() */
+	TSharedPtr<FNTimelineTrace> Trace;
+};
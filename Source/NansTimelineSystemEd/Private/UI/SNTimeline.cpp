@@ -15,8 +15,13 @@
 #include "SNTimeline.h"
 
 #include "SlateOptMacros.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Styling/CoreStyle.h"
+#include "Widgets/Layout/SScrollBar.h"
 #include "LogVisualizerStyle.h"
 #include "Event/EventBase.h"
+#include "Trace/TimelineTrace.h"
 
 #define LOCTEXT_NAMESPACE "NansTimelineSystemEd"
 
@@ -26,11 +31,62 @@ constexpr FColor SNTimeline::TimelineColor;
 constexpr ESlateDrawEffect SNTimeline::DrawEffects;
 constexpr float SNTimeline::TimelineHeight;
 constexpr float SNTimeline::EventHeight;
-constexpr float SNTimeline::UnitSecs;
+constexpr float SNTimeline::DefaultUnitSecs;
+constexpr float SNTimeline::MinUnitSecs;
+constexpr float SNTimeline::MaxUnitSecs;
+constexpr float SNTimeline::ZoomStep;
+constexpr float SNTimeline::RulerHeight;
+constexpr float SNTimeline::RulerMinStepWidth;
+constexpr float SNTimeline::RowsTop;
+constexpr float SNTimeline::PendingEndlessSecs;
 constexpr float SNTimeline::MarginVertical;
 constexpr float SNTimeline::PaddingHorizontal;
+constexpr float SNTimeline::LodMinSlotWidth;
+constexpr float SNTimeline::DensityBucketWidth;
+constexpr float SNTimeline::DensityFullCount;
 
-TMap<FName, FTimelineData> SNTimeline::TimelineRows;
+TMap<FName, TSharedRef<FTimelineData>> SNTimeline::TimelineRows;
+
+/** The notifications which change the layout of an event */
+static const ENTimelineEvent LaidOutEvents[] = {
+	ENTimelineEvent::AfterAttached, ENTimelineEvent::Start, ENTimelineEvent::Expired
+};
+
+FEventSlot::FEventSlot(const UNEventBase* InEvent) : Event(InEvent), UID(InEvent->GetGUID()) {}
+
+FEventSlot::FEventSlot(const FGuid& InUID) : Event(nullptr), UID(InUID) {}
+
+/** The color of an expired event */
+static FColor ToExpiredColor(const FColor& Color)
+{
+	constexpr float Alpha = 0.6f;
+	// Lerp to Gray
+	return (FLinearColor(Color) + Alpha * (FLinearColor::Gray - Color)).ToFColor(false);
+}
+
+float FEventSlot::GetStart() const
+{
+	return PreOffset > 0 ? PreOffset : Offset;
+}
+
+float FEventSlot::GetSize(const float& EndTime) const
+{
+	return bFollowsTime ? FMath::Max(EndTime - Offset, 0.f) : Size;
+}
+
+float FEventSlot::GetEnd(const float& EndTime) const
+{
+	return Offset + GetSize(EndTime);
+}
+
+const FText& FEventSlot::GetTooltip() const
+{
+	if (!Tooltip.IsSet())
+	{
+		Tooltip = IsValid(Event) ? FText::AsCultureInvariant(Event->GetDebugTooltipText()) : FText::GetEmpty();
+	}
+	return Tooltip.GetValue();
+}
 
 bool FEventsRow::AddSlot(FEventSlot&& InSlot)
 {
@@ -38,72 +94,224 @@ bool FEventsRow::AddSlot(FEventSlot&& InSlot)
 	if (Slots.Num() > 0)
 	{
 		const FEventSlot& LastEvent = Slots.Last();
-		const float RealOffset = InSlot.PreOffset > 0 ? InSlot.PreOffset : InSlot.Offset;
-		bHasPosition = LastEvent.Offset + LastEvent.Size <= RealOffset && LastEvent.Event->GetDuration() > 0;
+		bHasPosition = LastEvent.Offset + LastEvent.Size <= InSlot.GetStart() && !LastEvent.bIsEndless;
 	}
 
 	if (bHasPosition)
 	{
-		Slots.Add(InSlot);
+		Slots.Add(MoveTemp(InSlot));
 	}
 
 	return bHasPosition;
 }
 
-FEventSlot* FEventsRow::IsEventAdded(const UNEventBase* Event)
+bool FEventsRow::CanReplaceSlot(const int32& Index, const FEventSlot& InSlot) const
 {
-	FEventSlot* EventSlot = nullptr;
-	for (FEventSlot& Slot : Slots)
+	if (Index > 0)
 	{
-		if (Event == Slot.Event)
+		const FEventSlot& Previous = Slots[Index - 1];
+		if (Previous.bIsEndless || Previous.Offset + Previous.Size > InSlot.GetStart())
 		{
-			EventSlot = &Slot;
+			return false;
 		}
 	}
-	return EventSlot;
+	if (Index < Slots.Num() - 1)
+	{
+		return !InSlot.bIsEndless && InSlot.Offset + InSlot.Size <= Slots[Index + 1].GetStart();
+	}
+	return true;
+}
+
+int32 FEventsRow::LowerBound(const float& Time, const float& EndTime) const
+{
+	// Slots don't overlap, so they are sorted by their start and their end as well.
+	return Algo::LowerBoundBy(Slots, Time, [&EndTime](const FEventSlot& Slot) { return Slot.GetEnd(EndTime); });
+}
+
+int32 FEventsRow::FindSlotAt(const float& Time, const float& EndTime) const
+{
+	const int32 SlotNum = LowerBound(Time, EndTime);
+	return SlotNum < Slots.Num() && Slots[SlotNum].GetStart() <= Time ? SlotNum : INDEX_NONE;
 }
 
-FEventSlot* FTimelineData::IsEventAdded(const UNEventBase* Event)
+FTimelineData::~FTimelineData()
 {
-	FEventSlot* EventSlot = nullptr;
-	for (FEventsRow& Row : Rows)
+	StopListening();
+}
+
+FEventSlot* FTimelineData::FindSlot(const FGuid& UID)
+{
+	const FIntPoint* Index = SlotIndexes.Find(UID);
+	return Index != nullptr ? &Rows[Index->X].Slots[Index->Y] : nullptr;
+}
+
+void FTimelineData::AddSlot(FEventSlot&& Slot)
+{
+	const FGuid UID = Slot.UID;
+	if (SlotIndexes.Contains(UID))
+	{
+		return;
+	}
+
+	for (int32 RowNum = 0; RowNum < Rows.Num(); RowNum++)
 	{
-		EventSlot = Row.IsEventAdded(Event);
-		if (EventSlot != nullptr) break;
+		if (Rows[RowNum].AddSlot(MoveTemp(Slot)))
+		{
+			SlotIndexes.Add(UID, FIntPoint(RowNum, Rows[RowNum].Slots.Num() - 1));
+			return;
+		}
 	}
-	return EventSlot;
+
+	FEventsRow& NewRow = Rows.AddDefaulted_GetRef();
+	NewRow.AddSlot(MoveTemp(Slot));
+	SlotIndexes.Add(UID, FIntPoint(Rows.Num() - 1, 0));
 }
 
-void FTimelineData::AddSlot(FEventSlot&& Slot)
+void FTimelineData::UpdateSlot(FEventSlot&& Slot)
 {
-	bool bIsInRow = false;
+	const FIntPoint* Index = SlotIndexes.Find(Slot.UID);
+	if (Index != nullptr && Rows[Index->X].CanReplaceSlot(Index->Y, Slot))
+	{
+		Rows[Index->X].Slots[Index->Y] = MoveTemp(Slot);
+		return;
+	}
+
+	RemoveSlot(Slot.UID);
+	AddSlot(MoveTemp(Slot));
+}
 
-	if (IsEventAdded(Slot.Event) != nullptr)
+void FTimelineData::RemoveSlot(const FGuid& UID)
+{
+	FIntPoint Index;
+	if (!SlotIndexes.RemoveAndCopyValue(UID, Index))
 	{
 		return;
 	}
 
-	for (FEventsRow& Row : Rows)
+	TArray<FEventSlot>& Slots = Rows[Index.X].Slots;
+	Slots.RemoveAt(Index.Y);
+	for (int32 SlotNum = Index.Y; SlotNum < Slots.Num(); SlotNum++)
+	{
+		SlotIndexes[Slots[SlotNum].UID].Y = SlotNum;
+	}
+}
+
+void FTimelineData::Reset()
+{
+	Rows.Init(FEventsRow(), 6);
+	SlotIndexes.Reset();
+	DirtyEvents.Reset();
+	MaxTime = 0.f;
+}
+
+void FTimelineData::BuildRows(TArray<FEventSlot>&& InSlots)
+{
+	Reset();
+	bNeedsRebuild = false;
+	SlotIndexes.Reserve(InSlots.Num());
+	Algo::SortBy(InSlots, [](const FEventSlot& Slot) { return Slot.GetStart(); });
+
+	// Rows are free when their last slot ended, each slot takes the free row with the lowest index.
+	// Busy rows are sorted by the end of their last slot, an endless slot never frees its row.
+	TArray<int32> FreeRows;
+	TArray<TPair<float, int32>> BusyRows;
+	for (int32 RowNum = 0; RowNum < Rows.Num(); RowNum++)
+	{
+		FreeRows.HeapPush(RowNum);
+	}
+	const auto ByEnd = [](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; };
+
+	for (FEventSlot& Slot : InSlots)
 	{
-		if (Row.AddSlot(MoveTemp(Slot)))
+		while (BusyRows.Num() > 0 && BusyRows.HeapTop().Key <= Slot.GetStart())
 		{
-			bIsInRow = true;
-			break;
+			TPair<float, int32> Row;
+			BusyRows.HeapPop(Row, ByEnd, false);
+			FreeRows.HeapPush(Row.Value);
+		}
+
+		int32 RowNum = INDEX_NONE;
+		if (FreeRows.Num() > 0)
+		{
+			FreeRows.HeapPop(RowNum, false);
 		}
+		else
+		{
+			RowNum = Rows.AddDefaulted();
+		}
+
+		MaxTime = FMath::Max(MaxTime, Slot.Offset + Slot.Size);
+		if (!Slot.bIsEndless)
+		{
+			BusyRows.HeapPush(TPair<float, int32>(Slot.Offset + Slot.Size, RowNum), ByEnd);
+		}
+		SlotIndexes.Add(Slot.UID, FIntPoint(RowNum, Rows[RowNum].Slots.Num()));
+		Rows[RowNum].Slots.Add(MoveTemp(Slot));
+	}
+}
+
+void FTimelineData::Listen(UNTimelineManagerDecorator* InTimeline)
+{
+	StopListening();
+	Timeline = InTimeline;
+	bNeedsRebuild = true;
+	if (!Timeline.IsValid())
+	{
+		return;
+	}
+
+	for (const ENTimelineEvent& EventName : LaidOutEvents)
+	{
+		InTimeline->OnEventsChanged(EventName).AddRaw(this, &FTimelineData::OnEventsChanged);
+	}
+	InTimeline->OnExpiredEventEvicted().AddRaw(this, &FTimelineData::OnExpiredEventEvicted);
+	InTimeline->OnEventBasesReset().AddRaw(this, &FTimelineData::OnEventBasesReset);
+}
+
+void FTimelineData::StopListening()
+{
+	if (!Timeline.IsValid())
+	{
+		return;
 	}
 
-	if (!bIsInRow)
+	for (const ENTimelineEvent& EventName : LaidOutEvents)
+	{
+		Timeline->OnEventsChanged(EventName).RemoveAll(this);
+	}
+	Timeline->OnExpiredEventEvicted().RemoveAll(this);
+	Timeline->OnEventBasesReset().RemoveAll(this);
+	Timeline.Reset();
+}
+
+void FTimelineData::OnEventsChanged(TArrayView<const FNTimelineNotification> Notifications)
+{
+	for (const FNTimelineNotification& Notification : Notifications)
 	{
-		FEventsRow NewRow = FEventsRow();
-		NewRow.AddSlot(MoveTemp(Slot));
-		Rows.Add(NewRow);
+		DirtyEvents.Add(Notification.Event->GetGUID());
 	}
 }
 
+void FTimelineData::OnExpiredEventEvicted(const FGuid& UID)
+{
+	DirtyEvents.Add(UID);
+}
+
+void FTimelineData::OnEventBasesReset()
+{
+	bNeedsRebuild = true;
+}
+
 BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 void SNTimeline::Construct(const FArguments& InArgs)
 {
+	ExternalScrollbar = InArgs._ExternalScrollbar;
+	if (ExternalScrollbar.IsValid())
+	{
+		ExternalScrollbar->SetOnUserScrolled(FOnUserScrolled::CreateSP(this, &SNTimeline::OnUserScrolled));
+	}
+
 	DelegateEndGameHandle = FWorldDelegates::OnWorldBeginTearDown.AddLambda(
 		[this](UWorld* World)
 		{
@@ -142,13 +350,13 @@ SNTimeline::~SNTimeline()
 
 	if (CurrentTimelineName != NAME_None && TimelineRows.Contains(CurrentTimelineName))
 	{
-		if (TimelineRows[CurrentTimelineName].Owners == 1)
+		if (TimelineRows[CurrentTimelineName]->Owners == 1)
 		{
 			TimelineRows.Remove(CurrentTimelineName);
 		}
 		else
 		{
-			TimelineRows[CurrentTimelineName].Owners--;
+			TimelineRows[CurrentTimelineName]->Owners--;
 		}
 	}
 }
@@ -158,18 +366,19 @@ void SNTimeline::ChangeTimeline(UNTimelineManagerDecorator* Timeline)
 	if (CurrentTimelineName != NAME_None
 		&& TimelineRows.Contains(CurrentTimelineName))
 	{
-		if (TimelineRows[CurrentTimelineName].Owners == 1)
+		if (TimelineRows[CurrentTimelineName]->Owners == 1)
 		{
 			TimelineRows.Remove(CurrentTimelineName);
 		}
 		else
 		{
-			TimelineRows[CurrentTimelineName].Owners--;
+			TimelineRows[CurrentTimelineName]->Owners--;
 		}
 	}
 
-	CurrentRowNum = -1;
-	CurrentSlotNum = -1;
+	HoveredEventUID.Invalidate();
+	HoveredTooltip = FText::GetEmpty();
+	ViewStartTime = 0.f;
 
 	if (IsValid(Timeline))
 	{
@@ -177,120 +386,189 @@ void SNTimeline::ChangeTimeline(UNTimelineManagerDecorator* Timeline)
 		CurrentTimelineName = CurrentTimeline->GetLabel();
 		if (!TimelineRows.Contains(CurrentTimelineName))
 		{
-			TimelineRows.Add(CurrentTimelineName, FTimelineData());
+			TimelineRows.Add(CurrentTimelineName, MakeShared<FTimelineData>());
 		}
-		TimelineRows[CurrentTimelineName].Owners++;
+		TimelineRows[CurrentTimelineName]->Owners++;
 	}
 }
 
-FVector2D SNTimeline::ComputeDesiredSize(float) const
+bool SNTimeline::HasValidTimeline() const
 {
-	float YSize = 4.f;
-	float XSize = 500.f;
-	if (IsInGameThread() && bShouldComputeSize)
+	return IsValid(CurrentTimeline) && !CurrentTimeline->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed)
+		   && CurrentTimeline->GetTimeline().IsValid();
+}
+
+FTimelineData* SNTimeline::GetShownData() const
+{
+	if (Trace.IsValid())
 	{
-		const bool bIsDecoTimeline = IsValid(CurrentTimeline) && !CurrentTimeline->HasAnyFlags(
-										 RF_BeginDestroyed | RF_FinishDestroyed
-									 );
-		const bool bIsTimeline = bIsDecoTimeline && CurrentTimeline->GetTimeline().IsValid();
-		const float Time = bIsTimeline ? CurrentTimeline->GetCurrentTime() : 0;
+		return TraceData.Get();
+	}
+	return TimelineRows.Contains(CurrentTimelineName) ? &TimelineRows[CurrentTimelineName].Get() : nullptr;
+}
 
-		if (bIsTimeline && TimelineRows.Contains(CurrentTimelineName))
-		{
-			YSize += (EventHeight + MarginVertical) * TimelineRows[CurrentTimelineName].Rows.Num();
-			XSize = TimelineRows[CurrentTimelineName].MaxTime > Time
-						? TimelineRows[CurrentTimelineName].MaxTime * UnitSecs
-						: Time * UnitSecs;
-			XSize = FMath::Max(XSize, 500.f);
-		}
+float SNTimeline::GetTotalTime() const
+{
+	if (Trace.IsValid())
+	{
+		return Trace->GetDuration();
+	}
+	if (!HasValidTimeline() || !TimelineRows.Contains(CurrentTimelineName))
+	{
+		return 0.f;
+	}
+	return FMath::Max(TimelineRows[CurrentTimelineName]->MaxTime, CurrentTimeline->GetCurrentTime());
+}
+
+FVector2D SNTimeline::ComputeDesiredSize(float) const
+{
+	float YSize = 4.f + RulerHeight;
+	// The width doesn't depend on the timeline anymore, the view is zoomed and panned instead.
+	const float XSize = 500.f;
+	const bool bIsLive = IsInGameThread() && bShouldComputeSize && HasValidTimeline();
+	const FTimelineData* TimelineData = GetShownData();
+	if ((Trace.IsValid() || bIsLive) && TimelineData != nullptr)
+	{
+		YSize += (EventHeight + MarginVertical) * TimelineData->Rows.Num();
 	}
 	return FVector2D(XSize, YSize);
 }
 
-FReply SNTimeline::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+void SNTimeline::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
-	if (!IsInGameThread() || !bShouldComputeSize)
+	if (!IsInGameThread() || (!bShouldComputeSize && !Trace.IsValid()))
 	{
-		return FReply::Unhandled();
+		return;
 	}
 
-	if (!TimelineRows.Contains(CurrentTimelineName) || TimelineRows[CurrentTimelineName].Rows.Num() <= 0)
+	const float TotalTime = GetTotalTime();
+	const float ViewSecs = AllottedGeometry.GetLocalSize().X / UnitSecs;
+	ViewStartTime = FMath::Clamp(ViewStartTime, 0.f, FMath::Max(0.f, TotalTime - ViewSecs));
+
+	if (ExternalScrollbar.IsValid())
 	{
-		return FReply::Unhandled();
+		const bool bIsInView = TotalTime <= ViewSecs;
+		ExternalScrollbar->SetState(
+			bIsInView ? 0.f : ViewStartTime / TotalTime,
+			bIsInView ? 1.f : ViewSecs / TotalTime
+		);
 	}
+}
 
-	const FVector2D CursorPos = MyGeometry.AbsoluteToLocal(MouseEvent.GetLastScreenSpacePosition());
-	int32 RowNum = 0;
-	int32 SlotNum = 0;
+void SNTimeline::OnUserScrolled(const float ScrollOffsetFraction)
+{
+	ViewStartTime = ScrollOffsetFraction * GetTotalTime();
+}
 
-	int32 ChosenSlotNum = -1;
-	int32 ChosenRowNum = -1;
+FReply SNTimeline::OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (MouseEvent.IsShiftDown())
+	{
+		return FReply::Unhandled();
+	}
 
-	for (const FEventsRow& Row : TimelineRows[CurrentTimelineName].Rows)
+	// The time under the cursor stays in place
+	const float CursorX = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()).X;
+	const float CursorTime = ViewStartTime + CursorX / UnitSecs;
+	UnitSecs = FMath::Clamp(UnitSecs * FMath::Pow(ZoomStep, MouseEvent.GetWheelDelta()), MinUnitSecs, MaxUnitSecs);
+	ViewStartTime = FMath::Max(0.f, CursorTime - CursorX / UnitSecs);
+	return FReply::Handled();
+}
+
+FReply SNTimeline::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton)
 	{
-		const float RowYMin = TimelineHeight + RowNum * (EventHeight + MarginVertical);
-		const float RowYMax = RowYMin + EventHeight;
+		return FReply::Unhandled();
+	}
+	return FReply::Handled().CaptureMouse(SharedThis(this));
+}
 
-		if (CursorPos.Y < RowYMin)
-		{
-			break;
-		}
+FReply SNTimeline::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton || !HasMouseCapture())
+	{
+		return FReply::Unhandled();
+	}
+	return FReply::Handled().ReleaseMouseCapture();
+}
 
-		if (CursorPos.Y > RowYMax)
-		{
-			RowNum++;
-			continue;
-		}
+FReply SNTimeline::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (!IsInGameThread() || (!bShouldComputeSize && !Trace.IsValid()))
+	{
+		return FReply::Unhandled();
+	}
 
-		for (const FEventSlot& Slot : Row.Slots)
-		{
-			const float RowXMin = Slot.PreOffset > 0 ? Slot.PreOffset : Slot.Offset;
-			const float RowXMax = RowXMin + Slot.PreSize + Slot.Size;
+	if (HasMouseCapture())
+	{
+		ViewStartTime = FMath::Max(0.f, ViewStartTime - MouseEvent.GetCursorDelta().X / MyGeometry.Scale / UnitSecs);
+		return FReply::Handled();
+	}
 
-			if (CursorPos.X > + RowXMin && CursorPos.X <= RowXMax)
-			{
-				ChosenSlotNum = SlotNum;
-				ChosenRowNum = RowNum;
-				break;
-			}
-			SlotNum++;
-		}
-		RowNum++;
+	const FTimelineData* TimelineData = GetShownData();
+	if (TimelineData == nullptr || TimelineData->Rows.Num() <= 0)
+	{
+		return FReply::Unhandled();
 	}
 
-	if (ChosenRowNum > -1 && ChosenSlotNum > -1)
+	const FVector2D CursorPos = MyGeometry.AbsoluteToLocal(MouseEvent.GetLastScreenSpacePosition());
+	float EndTime = Trace.IsValid() ? ScrubTime : 0.f;
+	if (!Trace.IsValid() && IsValid(CurrentTimeline))
 	{
-		if (ChosenRowNum != CurrentRowNum || ChosenSlotNum != CurrentSlotNum)
+		EndTime = CurrentTimeline->GetCurrentTime();
+	}
+	const TArray<FEventsRow>& Rows = TimelineData->Rows;
+
+	// Rows have the same height, as painted in SNTimeline::OnPaint()
+	const float RowsY = CursorPos.Y - RowsTop;
+	const int32 RowNum = FMath::FloorToInt(RowsY / (EventHeight + MarginVertical));
+	const bool bIsInRow = RowsY >= 0 && Rows.IsValidIndex(RowNum)
+						  && RowsY - RowNum * (EventHeight + MarginVertical) <= EventHeight;
+	const float CursorTime = ViewStartTime + CursorPos.X / UnitSecs;
+	// What happened after the scrub time is not drawn
+	const bool bIsDrawn = !Trace.IsValid() || CursorTime <= ScrubTime;
+	const int32 SlotNum = bIsInRow && bIsDrawn ? Rows[RowNum].FindSlotAt(CursorTime, EndTime) : INDEX_NONE;
+
+	if (SlotNum != INDEX_NONE)
+	{
+		const FEventSlot& Slot = Rows[RowNum].Slots[SlotNum];
+		const FText& Tooltip = GetSlotTooltip(Slot);
+		if (Slot.UID != HoveredEventUID || !Tooltip.IdenticalTo(HoveredTooltip))
 		{
-			CurrentRowNum = ChosenRowNum;
-			CurrentSlotNum = ChosenSlotNum;
-			const UNEventBase* EventFound = TimelineRows[CurrentTimelineName].Rows[CurrentRowNum].Slots[CurrentSlotNum].
-				Event;
-
-			if (IsValid(EventFound))
-			{
-				SetToolTipText(FText::AsCultureInvariant(EventFound->GetDebugTooltipText()));
-			}
+			HoveredEventUID = Slot.UID;
+			HoveredTooltip = Tooltip;
+			SetToolTipText(Tooltip);
 		}
 		return FReply::Handled();
 	}
 
-	CurrentRowNum = -1;
-	CurrentSlotNum = -1;
-	SetToolTipText(FText::AsCultureInvariant(TEXT("")));
+	if (HoveredEventUID.IsValid())
+	{
+		HoveredEventUID.Invalidate();
+		HoveredTooltip = FText::GetEmpty();
+		SetToolTipText(HoveredTooltip);
+	}
 	return FReply::Unhandled();
 }
 
-void SNTimeline::CreateSlot(const float EndPos, const UNEventBase* Event) const
+FEventSlot SNTimeline::CreateSlot(const UNEventBase* Event) const
 {
 	FEventSlot Slot(Event);
-	float EventStartedAt = Event->GetStartedAt() >= 0.f ? UnitSecs * Event->GetStartedAt() : -1.f;
+	float EventStartedAt = Event->GetStartedAt() >= 0.f ? Event->GetStartedAt() : -1.f;
 	// This for events that are forward the end of the current timeline (in the future),
-	// otherwise they will not have a width cause it is calculate with the end position of the timeline bar.
-	Slot.Size = EventStartedAt >= 0 ? EndPos - EventStartedAt : 10.f;
-	if (Event->GetDuration() > 0)
+	// otherwise they will not have a width cause it is calculate with the end of the timeline bar.
+	Slot.Size = PendingEndlessSecs;
+	Slot.bIsEndless = Event->GetDuration() <= 0;
+	if (!Slot.bIsEndless)
 	{
-		Slot.Size = UnitSecs * Event->GetDuration();
+		Slot.Size = Event->GetDuration();
+	}
+	else if (EventStartedAt >= 0)
+	{
+		// A running endless event ends with the timeline, an expired one where it has been stopped.
+		Slot.bFollowsTime = !Event->IsExpired();
+		Slot.Size = Event->GetLocalTime();
 	}
 
 	FColor Color = Event->GetDebugColor();
@@ -300,20 +578,18 @@ void SNTimeline::CreateSlot(const float EndPos, const UNEventBase* Event) const
 	{
 		Color = Color.WithAlpha(Color.A / 1.5);
 		PreColor = PreColor.WithAlpha(PreColor.A / 1.5);
-		EventStartedAt = (Event->GetAttachedTime() + Event->GetDelay()) * UnitSecs;
+		EventStartedAt = Event->GetAttachedTime() + Event->GetDelay();
 	}
 
 	if (Event->IsExpired())
 	{
-		constexpr float Alpha = 0.6f;
-		// Lerp to Gray
-		Color = (FLinearColor(Color) + Alpha * (FLinearColor::Gray - Color)).ToFColor(false);
-		PreColor = (FLinearColor(PreColor) + Alpha * (FLinearColor::Gray - PreColor)).ToFColor(false);;
+		Color = ToExpiredColor(Color);
+		PreColor = ToExpiredColor(PreColor);
 	}
 
 	if (Event->GetDelay() > 0)
 	{
-		const float DelayStartedAt = Event->GetAttachedTime() * UnitSecs;
+		const float DelayStartedAt = Event->GetAttachedTime();
 		const float DelayWidth = EventStartedAt - DelayStartedAt;
 
 		Slot.PreColor = PreColor;
@@ -323,18 +599,62 @@ void SNTimeline::CreateSlot(const float EndPos, const UNEventBase* Event) const
 
 	Slot.Color = Color;
 	Slot.Offset = EventStartedAt;
+	return Slot;
+}
 
-	FTimelineData& TimelineData = TimelineRows[CurrentTimelineName];
+void SNTimeline::UpdateLayout(FTimelineData& TimelineData) const
+{
+	if (TimelineData.Timeline.Get() != CurrentTimeline)
+	{
+		TimelineData.Listen(CurrentTimeline);
+	}
 
 	// This to allow drawing events in the future
+	auto UpdateMaxTime = [&TimelineData](const FEventSlot& Slot)
+	{
+		TimelineData.MaxTime = FMath::Max(TimelineData.MaxTime, Slot.Offset + Slot.Size);
+	};
+
+	if (TimelineData.bNeedsRebuild)
 	{
-		const float EventEndedAt = (EventStartedAt + Slot.Size) / UnitSecs;
-		TimelineData.MaxTime = TimelineData.MaxTime < EventEndedAt
-								   ? EventEndedAt
-								   : TimelineData.MaxTime;
+		TimelineData.bNeedsRebuild = false;
+		TimelineData.Reset();
+		for (const UNEventBase* Event : CurrentTimeline->GetExpiredEvents())
+		{
+			FEventSlot Slot = CreateSlot(Event);
+			UpdateMaxTime(Slot);
+			TimelineData.AddSlot(MoveTemp(Slot));
+		}
+
+		for (const UNEventBase* Event : CurrentTimeline->GetEvents())
+		{
+			FEventSlot Slot = CreateSlot(Event);
+			UpdateMaxTime(Slot);
+			TimelineData.AddSlot(MoveTemp(Slot));
+		}
+		return;
 	}
 
-	TimelineData.AddSlot(MoveTemp(Slot));
+	for (const FGuid& UID : TimelineData.DirtyEvents)
+	{
+		const UNEventBase* Event = CurrentTimeline->GetEvent(UID);
+		if (Event == nullptr)
+		{
+			Event = CurrentTimeline->GetExpiredEvent(UID);
+		}
+
+		// Evicted, pooled or attached without UNEventBase
+		if (!IsValid(Event))
+		{
+			TimelineData.RemoveSlot(UID);
+			continue;
+		}
+
+		FEventSlot Slot = CreateSlot(Event);
+		UpdateMaxTime(Slot);
+		TimelineData.UpdateSlot(MoveTemp(Slot));
+	}
+	TimelineData.DirtyEvents.Reset();
 }
 
 int32 SNTimeline::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
@@ -342,99 +662,348 @@ int32 SNTimeline::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeome
 	bool bParentEnabled) const
 {
 	int32 RetLayerId = LayerId;
-	if (GEditor->PlayWorld == nullptr || !IsValid(CurrentTimeline) || !CurrentTimeline->GetTimeline().IsValid()
-		|| !TimelineRows.Contains(CurrentTimelineName))
+	const bool bIsReplaying = Trace.IsValid();
+	if (!bIsReplaying && (GEditor->PlayWorld == nullptr || !IsValid(CurrentTimeline)
+		|| !CurrentTimeline->GetTimeline().IsValid() || !TimelineRows.Contains(CurrentTimelineName)))
 	{
 		return RetLayerId;
 	}
 
-	const float EndPos = CurrentTimeline->GetCurrentTime() * UnitSecs;
-	float YPos = 0;
-	float NewYPos = TimelineHeight;
-
-	if (EndPos <= 0)
+	// A trace is drawn until its scrub time
+	const float EndTime = bIsReplaying ? ScrubTime : CurrentTimeline->GetCurrentTime();
+	if (EndTime <= 0)
 	{
 		return RetLayerId;
 	}
-	const float BarWidth = EndPos;
-
-	FSlateDrawElement::MakeBox(
-		OutDrawElements,
-		++RetLayerId,
-		AllottedGeometry.ToPaintGeometry(
-			FVector2D(0.f, YPos),
-			FVector2D(BarWidth, NewYPos)
-		),
-		FillImage,
-		DrawEffects,
-		TimelineColor
-	);
-	YPos += NewYPos + MarginVertical;
-	NewYPos = EventHeight;
 
-	const TArray<UNEventBase*> ExpiredEvents = CurrentTimeline->GetExpiredEvents();
-	const TArray<UNEventBase*> Events = CurrentTimeline->GetEvents();
+	FTimelineData& TimelineData = *GetShownData();
+	if (!bIsReplaying)
+	{
+		UpdateLayout(TimelineData);
+	}
+
+	// Only the rows and the times in the visible part of the widget are painted
+	const FVector2D VisibleMin = AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetTopLeft());
+	const FVector2D VisibleMax = AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetBottomRight());
+	const float MinTime = ViewStartTime + FMath::Max(VisibleMin.X, 0.f) / UnitSecs;
+	const float MaxTime = ViewStartTime + FMath::Min(VisibleMax.X, AllottedGeometry.GetLocalSize().X) / UnitSecs;
+	const float MaxSlotTime = bIsReplaying ? FMath::Min(MaxTime, EndTime) : MaxTime;
+
+	PaintRuler(MinTime, MaxTime, AllottedGeometry, OutDrawElements, ++RetLayerId);
+
+	const float BarWidth = (FMath::Min(EndTime, MaxTime) - ViewStartTime) * UnitSecs;
+	if (BarWidth > 0.f)
+	{
+		FSlateDrawElement::MakeBox(
+			OutDrawElements,
+			++RetLayerId,
+			AllottedGeometry.ToPaintGeometry(
+				FVector2D(0.f, RulerHeight),
+				FVector2D(BarWidth, TimelineHeight)
+			),
+			FillImage,
+			DrawEffects,
+			TimelineColor
+		);
+	}
 
-	FTimelineData& TimelineData = TimelineRows[CurrentTimelineName];
-	TimelineData.Rows.Init(FEventsRow(), 6);
+	constexpr float RowHeight = EventHeight + MarginVertical;
+	const int32 FirstRow = FMath::Max(0, FMath::FloorToInt((VisibleMin.Y - RowsTop) / RowHeight));
+	const int32 LastRow = FMath::Min(TimelineData.Rows.Num() - 1, FMath::FloorToInt((VisibleMax.Y - RowsTop) / RowHeight));
 
-	for (const UNEventBase* Event : ExpiredEvents)
+	// Delays and events never overlap, each kind is drawn in one layer
+	const int32 DelayLayerId = ++RetLayerId;
+	const int32 EventLayerId = ++RetLayerId;
+	for (int32 RowNum = FirstRow; RowNum <= LastRow; RowNum++)
 	{
-		CreateSlot(EndPos, Event);
+		PaintRow(
+			TimelineData.Rows[RowNum], RowsTop + RowNum * RowHeight, MinTime, MaxSlotTime, EndTime, bIsReplaying,
+			AllottedGeometry, OutDrawElements, DelayLayerId, EventLayerId
+		);
 	}
 
-	for (const UNEventBase* Event : Events)
+	return RetLayerId;
+}
+
+/** Formats a time of the ruler, long times are shown in minutes or hours. */
+static FString FormatRulerTime(const float& Secs, const float& Step)
+{
+	const int32 WholeSecs = FMath::RoundToInt(Secs);
+	if (Step < 1.f || WholeSecs < 60)
 	{
-		CreateSlot(EndPos, Event);
+		return FString::Printf(TEXT("%gs"), Secs);
 	}
+	if (WholeSecs < 3600)
+	{
+		return FString::Printf(TEXT("%dm%02ds"), WholeSecs / 60, WholeSecs % 60);
+	}
+	return Step < 60.f
+			   ? FString::Printf(TEXT("%dh%02dm%02ds"), WholeSecs / 3600, WholeSecs / 60 % 60, WholeSecs % 60)
+			   : FString::Printf(TEXT("%dh%02dm"), WholeSecs / 3600, WholeSecs / 60 % 60);
+}
 
-	for (FEventsRow& Row : TimelineData.Rows)
+void SNTimeline::PaintRuler(const float MinTime, const float MaxTime, const FGeometry& AllottedGeometry,
+	FSlateWindowElementList& OutDrawElements, const int32 LayerId) const
+{
+	// The step is the smallest 1, 2 or 5 x 10^N secs leaving room for the labels
+	const float MinStep = RulerMinStepWidth / UnitSecs;
+	float Step = FMath::Pow(10.f, FMath::FloorToFloat(FMath::LogX(10.f, MinStep)));
+	for (const float Multiplier : {1.f, 2.f, 5.f, 10.f})
 	{
-		if (Row.Slots.Num() > 0)
+		if (Step * Multiplier >= MinStep)
 		{
-			for (const FEventSlot& Slot : Row.Slots)
+			Step *= Multiplier;
+			break;
+		}
+	}
+
+	const FSlateFontInfo Font = FCoreStyle::GetDefaultFontStyle("Regular", 7);
+	// The label at the left of the view can be partially visible
+	const int64 FirstGraduation = FMath::FloorToInt(FMath::Max(MinTime - MinStep, 0.f) / Step);
+	for (int64 Graduation = FirstGraduation; Graduation * Step <= MaxTime; Graduation++)
+	{
+		const float Time = Graduation * Step;
+		const float X = (Time - ViewStartTime) * UnitSecs;
+		FSlateDrawElement::MakeBox(
+			OutDrawElements,
+			LayerId,
+			AllottedGeometry.ToPaintGeometry(FVector2D(X, 0.f), FVector2D(1.f, RulerHeight)),
+			FillImage,
+			DrawEffects,
+			TimelineColor
+		);
+		FSlateDrawElement::MakeText(
+			OutDrawElements,
+			LayerId,
+			AllottedGeometry.ToPaintGeometry(FVector2D(X + 2.f, 0.f), FVector2D(RulerMinStepWidth, RulerHeight)),
+			FormatRulerTime(Time, Step),
+			Font,
+			DrawEffects,
+			FLinearColor::White
+		);
+	}
+}
+
+void SNTimeline::PaintRow(const FEventsRow& Row, const float YPos, const float MinTime, const float MaxTime,
+	const float EndTime, const bool bIsReplaying, const FGeometry& AllottedGeometry,
+	FSlateWindowElementList& OutDrawElements, const int32 DelayLayerId, const int32 EventLayerId) const
+{
+	const TArray<FEventSlot>& Slots = Row.Slots;
+	auto ToX = [this](const float& Time) { return (Time - ViewStartTime) * UnitSecs; };
+	// A replayed trace is laid out in its final state, nothing is drawn after the scrub time
+	const float ClipTime = bIsReplaying ? EndTime : TNumericLimits<float>::Max();
+	int32 SlotNum = Row.LowerBound(MinTime, EndTime);
+
+	while (SlotNum < Slots.Num() && Slots[SlotNum].GetStart() <= MaxTime)
+	{
+		const FEventSlot& Slot = Slots[SlotNum];
+		const float Start = Slot.GetStart();
+		const float Size = Slot.GetSize(EndTime);
+
+		// Too small to be seen alone, the slots starting in the next pixels are drawn as one density bar
+		if ((Slot.PreSize + Size) * UnitSecs < LodMinSlotWidth)
+		{
+			const float BucketEnd = Start + DensityBucketWidth / UnitSecs;
+			const TArrayView<const FEventSlot> Next = MakeArrayView(Slots).Slice(SlotNum, Slots.Num() - SlotNum);
+			int32 BucketNum = Algo::LowerBoundBy(Next, BucketEnd, [](const FEventSlot& Other) { return Other.GetStart(); });
+			// Only the last one can go over the bucket, it is drawn alone
+			if (BucketNum > 1 && Next[BucketNum - 1].GetEnd(EndTime) > BucketEnd)
 			{
-				bool bHasPre = false;
-				// int32 LayerId = ++RetLayerId;
-				if (Slot.PreSize > 0.f)
-				{
-					bHasPre = true;
-					FSlateDrawElement::MakeBox(
-						OutDrawElements,
-						++RetLayerId,
-						AllottedGeometry.ToPaintGeometry(
-							FVector2D(Slot.PreOffset + PaddingHorizontal, YPos),
-							FVector2D(Slot.PreSize, EventHeight)
-						),
-						FillImage,
-						DrawEffects,
-						Slot.PreColor
-					);
-				}
+				BucketNum--;
+			}
 
+			if (BucketNum > 1)
+			{
+				const float Density = FMath::Min(1.f, BucketNum / DensityFullCount);
 				FSlateDrawElement::MakeBox(
 					OutDrawElements,
-					++RetLayerId,
+					EventLayerId,
 					AllottedGeometry.ToPaintGeometry(
-						FVector2D(Slot.Offset + (bHasPre ? 0.f : PaddingHorizontal), YPos),
-						FVector2D(Slot.Size - PaddingHorizontal, EventHeight)
+						FVector2D(ToX(Start) + PaddingHorizontal, YPos),
+						FVector2D((FMath::Min(Next[BucketNum - 1].GetEnd(EndTime), ClipTime) - Start) * UnitSecs, EventHeight)
 					),
 					FillImage,
 					DrawEffects,
-					Slot.Color
+					FLinearColor(Slot.Color).CopyWithNewOpacity(FMath::Lerp(0.4f, 1.f, Density))
 				);
+				SlotNum += BucketNum;
+				continue;
 			}
 		}
 
-		YPos += NewYPos + MarginVertical;
-		NewYPos = EventHeight;
-	}
+		bool bHasPre = false;
+		if (Slot.PreSize > 0.f)
+		{
+			bHasPre = true;
+			FSlateDrawElement::MakeBox(
+				OutDrawElements,
+				DelayLayerId,
+				AllottedGeometry.ToPaintGeometry(
+					FVector2D(ToX(Slot.PreOffset) + PaddingHorizontal, YPos),
+					FVector2D((FMath::Min(Slot.PreOffset + Slot.PreSize, ClipTime) - Slot.PreOffset) * UnitSecs, EventHeight)
+				),
+				FillImage,
+				DrawEffects,
+				Slot.PreColor
+			);
+		}
 
-	return RetLayerId;
+		if (Slot.Offset >= ClipTime)
+		{
+			SlotNum++;
+			continue;
+		}
+
+		// While replaying, slots ended before the scrub time look expired as in the live view
+		const bool bIsEnded = bIsReplaying && !Slot.bFollowsTime && Slot.GetEnd(EndTime) <= EndTime;
+		FSlateDrawElement::MakeBox(
+			OutDrawElements,
+			EventLayerId,
+			AllottedGeometry.ToPaintGeometry(
+				FVector2D(ToX(Slot.Offset) + (bHasPre ? 0.f : PaddingHorizontal), YPos),
+				FVector2D(
+					FMath::Max((FMath::Min(Slot.Offset + Size, ClipTime) - Slot.Offset) * UnitSecs - PaddingHorizontal, 1.f),
+					EventHeight
+				)
+			),
+			FillImage,
+			DrawEffects,
+			bIsEnded ? ToExpiredColor(Slot.Color) : Slot.Color
+		);
+		SlotNum++;
+	}
 }
 
 UNTimelineManagerDecorator* SNTimeline::GetCurrentTimeline() const { return CurrentTimeline; }
 
+void SNTimeline::ShowTrace(const TSharedPtr<FNTimelineTrace>& InTrace)
+{
+	Trace = InTrace;
+	TraceData.Reset();
+	HoveredEventUID.Invalidate();
+	HoveredTooltip = FText::GetEmpty();
+	SetToolTipText(HoveredTooltip);
+	ViewStartTime = 0.f;
+	ScrubTime = 0.f;
+
+	if (Trace.IsValid())
+	{
+		TraceData = MakeShared<FTimelineData>();
+		LayOutTrace(*Trace, *TraceData);
+		ScrubTime = Trace->GetDuration();
+	}
+}
+
+TSharedPtr<FNTimelineTrace> SNTimeline::GetShownTrace() const
+{
+	return Trace;
+}
+
+void SNTimeline::SetScrubTime(const float& InTime)
+{
+	ScrubTime = Trace.IsValid() ? FMath::Clamp(InTime, 0.f, Trace->GetDuration()) : 0.f;
+}
+
+float SNTimeline::GetScrubTime() const
+{
+	return ScrubTime;
+}
+
+void SNTimeline::LayOutTrace(const FNTimelineTrace& InTrace, FTimelineData& OutData)
+{
+	/** The records of one event, the notifications of a batch can be recorded after a later batch. */
+	struct FTracedEvent
+	{
+		const FNTimelineTraceRecord* Attached = nullptr;
+		float StartedAt = -1.f;
+		float ExpiredAt = -1.f;
+	};
+
+	TMap<FGuid, FTracedEvent> Events;
+	Events.Reserve(InTrace.Num() / 3);
+	for (int32 Idx = 0; Idx < InTrace.Num(); Idx++)
+	{
+		const FNTimelineTraceRecord& Record = InTrace[Idx];
+		FTracedEvent& Event = Events.FindOrAdd(Record.UID);
+		switch (Record.EventName)
+		{
+			case ENTimelineEvent::AfterAttached:
+				Event.Attached = &Record;
+				break;
+			case ENTimelineEvent::Start:
+				Event.StartedAt = Record.Time;
+				break;
+			case ENTimelineEvent::Expired:
+				Event.ExpiredAt = Record.Time;
+				break;
+			default:
+				break;
+		}
+	}
+
+	TArray<FEventSlot> Slots;
+	Slots.Reserve(Events.Num());
+	for (const TPair<FGuid, FTracedEvent>& Pair : Events)
+	{
+		const FTracedEvent& Event = Pair.Value;
+		// Its attachment has been dropped with the oldest records, nothing tells where it begins
+		if (Event.Attached == nullptr)
+		{
+			continue;
+		}
+
+		const FNTimelineTraceRecord& Attached = *Event.Attached;
+		FEventSlot Slot(Pair.Key);
+		Slot.LabelIndex = Attached.LabelIndex;
+		Slot.Color = Attached.Color;
+		Slot.Offset = Event.StartedAt >= 0.f ? Event.StartedAt : Attached.Time + Attached.Delay;
+		Slot.bIsEndless = Attached.Duration <= 0.f;
+		Slot.Size = Slot.bIsEndless ? PendingEndlessSecs : Attached.Duration;
+		if (Slot.bIsEndless && Event.ExpiredAt >= 0.f)
+		{
+			Slot.Size = FMath::Max(Event.ExpiredAt - Slot.Offset, 0.f);
+		}
+		else if (Slot.bIsEndless && Event.StartedAt >= 0.f)
+		{
+			// Still running at the end of the record, it ends with the scrub time
+			Slot.bFollowsTime = true;
+			Slot.Size = FMath::Max(InTrace.GetDuration() - Slot.Offset, 0.f);
+		}
+
+		if (Slot.Offset > Attached.Time)
+		{
+			Slot.PreColor = Attached.Color.WithAlpha(Attached.Color.A / 2);
+			Slot.PreOffset = Attached.Time;
+			Slot.PreSize = Slot.Offset - Attached.Time;
+		}
+		Slots.Add(MoveTemp(Slot));
+	}
+
+	OutData.BuildRows(MoveTemp(Slots));
+	OutData.MaxTime = FMath::Max(OutData.MaxTime, InTrace.GetDuration());
+}
+
+const FText& SNTimeline::GetSlotTooltip(const FEventSlot& Slot) const
+{
+	if (!Trace.IsValid() || Slot.Event != nullptr)
+	{
+		return Slot.GetTooltip();
+	}
+
+	if (!Slot.Tooltip.IsSet())
+	{
+		const FString Label = Trace->GetLabel(Slot.LabelIndex).ToString();
+		FString Text = FString::Printf(TEXT("Label: %s\nUID: %s\nStarted at: %.2f"), *Label, *Slot.UID.ToString(), Slot.Offset);
+		if (Slot.PreSize > 0.f)
+		{
+			Text += FString::Printf(TEXT("\nAttached at: %.2f\nDelay: %.2f"), Slot.PreOffset, Slot.PreSize);
+		}
+		Text += Slot.bFollowsTime ? FString(TEXT("\nDuration: running")) : FString::Printf(TEXT("\nDuration: %.2f"), Slot.Size);
+		Slot.Tooltip = FText::AsCultureInvariant(Text);
+	}
+	return Slot.Tooltip.GetValue();
+}
+
 END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 #undef LOCTEXT_NAMESPACE
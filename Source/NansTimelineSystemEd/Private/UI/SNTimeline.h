@@ -18,10 +18,15 @@
 
 #include "Config/TimelineConfig.h"
 
-/** All details about an event to draw */
+class SScrollBar;
+class FNTimelineTrace;
+
+/** All details about an event to draw, in secs: they are converted to pixels when painted. */
 struct FEventSlot
 {
-	FEventSlot(const UNEventBase* InEvent) : Event(InEvent) {}
+	FEventSlot(const UNEventBase* InEvent);
+	/** A slot without UNEventBase, for a recorded event. @see SNTimeline::LayOutTrace() */
+	explicit FEventSlot(const FGuid& InUID);
 	/** Represents the moment this event has been attached if it has a delay. */
 	float PreOffset = 0.f;
 	/** If there is, the size of the delay. */
@@ -30,12 +35,32 @@ struct FEventSlot
 	FColor PreColor;
 	/** Represents the moment this event start to play. */
 	float Offset = 0.f;
-	/** Represents the event duration. */
+	/** Represents the event duration, @see GetSize() */
 	float Size = 0.f;
 	/** Color of the event. */
 	FColor Color;
 	/** Event associated to this slot. */
 	const UNEventBase* Event;
+	/** The UID of Event, @see FTimelineData::SlotIndexes */
+	FGuid UID;
+	/** The label of a recorded event in its trace, @see FNTimelineTrace::GetLabel() */
+	int32 LabelIndex = INDEX_NONE;
+	/** The event has no duration, nothing can be put after it in its row. */
+	bool bIsEndless = false;
+	/** The event is endless and running, it ends with the timeline. */
+	bool bFollowsTime = false;
+
+	/** Built at the first hover, a changed event gets a new slot. @see GetTooltip() */
+	mutable TOptional<FText> Tooltip;
+
+	/** Where this slot begins, its delay included. */
+	float GetStart() const;
+	/** @param EndTime - the current time of the timeline, the end of the running endless events. */
+	float GetSize(const float& EndTime) const;
+	/** @param EndTime - the current time of the timeline, the end of the running endless events. */
+	float GetEnd(const float& EndTime) const;
+	/** Returns the debug tooltip of Event, it is built once per slot. */
+	const FText& GetTooltip() const;
 };
 
 /**
@@ -44,7 +69,7 @@ struct FEventSlot
 */
 struct FEventsRow
 {
-	/** The slots saved in this row. */
+	/** The slots saved in this row, they don't overlap so they are sorted by position. */
 	TArray<FEventSlot> Slots;
 	/**
 	 * Try to add the slot.
@@ -52,26 +77,62 @@ struct FEventsRow
 	 * @return true if added or false if no places available for it 
 	 */
 	bool AddSlot(FEventSlot&& InSlot);
-	/** Checks if this event has been already added in any slot. */
-	FEventSlot* IsEventAdded(const UNEventBase* Event);
+	/** Checks if InSlot fits at Index between its neighbours. */
+	bool CanReplaceSlot(const int32& Index, const FEventSlot& InSlot) const;
+	/** Binary search of the first slot ending after Time, Slots.Num() if none. */
+	int32 LowerBound(const float& Time, const float& EndTime) const;
+	/** Binary search of the slot at Time, INDEX_NONE if none. */
+	int32 FindSlotAt(const float& Time, const float& EndTime) const;
 };
 
 /**
- * Saved data when timeline are paint.
- * @see SNTimeline::OnPaint()
+ * The layout of a timeline, shared by all the SNTimeline drawing it.
+ * It listens to the timeline notifications and only lays out the changed events at the next paint.
+ * @see SNTimeline::UpdateLayout()
  */
 struct FTimelineData
 {
+	/** Stops listening the timeline. */
+	~FTimelineData();
 	/** The rows where event's slot (FEventSlot) are saved. */
 	TArray<FEventsRow> Rows;
 	/** The current timeline time + events in the future. */
 	float MaxTime = 0.f;
 	/** Used to know if it can be destroyed. */
 	int32 Owners = 0;
-	/** Checks if this event has been already added in any row's slot. */
-	FEventSlot* IsEventAdded(const UNEventBase* Event);
+	/** The timeline this layout listens to. */
+	TWeakObjectPtr<UNTimelineManagerDecorator> Timeline;
+	/** The row (X) and the slot (Y) of each laid out event. */
+	TMap<FGuid, FIntPoint> SlotIndexes;
+	/** The events changed since the last layout. */
+	TSet<FGuid> DirtyEvents;
+	/** All events are laid out again at the next layout when true. */
+	bool bNeedsRebuild = true;
+
+	/** Returns the slot of this event, nullptr if it is not laid out. */
+	FEventSlot* FindSlot(const FGuid& UID);
 	/** Try to put this slot in an available row (FEventsRow) or create a new one if not already added in a row. */
 	void AddSlot(FEventSlot&& Slot);
+	/** Replaces the slot of this event, it keeps its place if it still fits in there. */
+	void UpdateSlot(FEventSlot&& Slot);
+	/** Removes the slot of this event, other slots of its row keep their places. */
+	void RemoveSlot(const FGuid& UID);
+	/** Removes all slots. */
+	void Reset();
+	/** Replaces all slots at once, each one takes the first row where it fits like with AddSlot(). */
+	void BuildRows(TArray<FEventSlot>&& InSlots);
+	/** Listens the notifications of InTimeline and stops listening the previous one. */
+	void Listen(UNTimelineManagerDecorator* InTimeline);
+	/** Stops listening Timeline. */
+	void StopListening();
+
+private:
+	/** Marks the notified events as dirty. */
+	void OnEventsChanged(TArrayView<const FNTimelineNotification> Notifications);
+	/** Marks the evicted event as dirty, @see FNTimelineManager::OnExpiredEventEvicted() */
+	void OnExpiredEventEvicted(const FGuid& UID);
+	/** @see UNTimelineManagerDecorator::OnEventBasesReset() */
+	void OnEventBasesReset();
 };
 
 /** This widget will draw timeline and events thanks to its UNTimelineManagerDecorator passed in. */
@@ -80,6 +141,8 @@ class NANSTIMELINESYSTEMED_API SNTimeline : public SLeafWidget
 public:
 	SLATE_BEGIN_ARGS(SNTimeline) {}
 		SLATE_ARGUMENT(UNTimelineManagerDecorator*, Timeline)
+		/** The horizontal scroll bar showing and panning the visible time range. */
+		SLATE_ARGUMENT(TSharedPtr<SScrollBar>, ExternalScrollbar)
 	SLATE_END_ARGS()
 
 	/**
@@ -98,15 +161,32 @@ public:
 	/** Compute the widget side depending on events and timeline data. */
 	virtual FVector2D ComputeDesiredSize(float) const override;
 
-	/** Manage tooltip to display event data. */
+	/** Manage tooltip to display event data, or pans the view while dragging. */
 	virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
 
+	/** Starts dragging the view with the left button. */
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+	/** Stops dragging the view. */
+	virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+	/** Zooms around the cursor, the wheel with shift is left to the parent scroll box. */
+	virtual FReply OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+	/** Keeps the view in the timeline and updates the scroll bar. */
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
 	/**
 	 * Create a slot to draw (@see SNTimeline::OnPaint()) based on event data.
-	 * @param EndPos - the current end position of the timeline, required to compute infinite event size.
 	 * @param Event - the UNEventBase to draw
 	 */
-	void CreateSlot(float EndPos, const UNEventBase* Event) const;
+	FEventSlot CreateSlot(const UNEventBase* Event) const;
+
+	/**
+	 * Lays out the events changed since the last paint, or all of them if the layout has to be rebuilt.
+	 * @param TimelineData - the layout of the current timeline
+	 */
+	void UpdateLayout(FTimelineData& TimelineData) const;
 
 	/** Will paint each event slots and timeline. */
 	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
@@ -116,7 +196,56 @@ public:
 	/** Get the current timeline, can returns nullptr. */
 	UNTimelineManagerDecorator* GetCurrentTimeline() const;
 
+	/**
+	 * Replays a recorded trace instead of the current timeline, it works without a game world.
+	 * @param InTrace - The trace to show, nullptr to go back to the current timeline
+	 */
+	void ShowTrace(const TSharedPtr<FNTimelineTrace>& InTrace);
+
+	/** @returns the replayed trace, nullptr if the current timeline is shown */
+	TSharedPtr<FNTimelineTrace> GetShownTrace() const;
+
+	/** Replays the trace until InTime. */
+	void SetScrubTime(const float& InTime);
+
+	/** @see SetScrubTime() */
+	float GetScrubTime() const;
+
+	/**
+	 * Lays out all the events of a trace in their final state,
+	 * the widget then only draws what happened before the scrub time.
+	 */
+	static void LayOutTrace(const FNTimelineTrace& InTrace, FTimelineData& OutData);
+
 private:
+	/**
+	 * Paints the slots of this row between MinTime and MaxTime.
+	 * The slots smaller than LodMinSlotWidth are gathered in density bars.
+	 * When replaying, slots are cut at EndTime and greyed once they have ended.
+	 */
+	void PaintRow(const FEventsRow& Row, float YPos, float MinTime, float MaxTime, float EndTime, bool bIsReplaying,
+		const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, int32 DelayLayerId,
+		int32 EventLayerId) const;
+
+	/** @returns the layout of the replayed trace or of the current timeline, nullptr if none */
+	FTimelineData* GetShownData() const;
+
+	/** @returns the tooltip of a slot, built from the trace when replaying */
+	const FText& GetSlotTooltip(const FEventSlot& Slot) const;
+
+	/** Paints the graduations and their time from MinTime to MaxTime. */
+	void PaintRuler(float MinTime, float MaxTime, const FGeometry& AllottedGeometry,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId) const;
+
+	/** @returns true if the current timeline can be read */
+	bool HasValidTimeline() const;
+
+	/** The time of the last event or the current time, 0 if there is no valid timeline. */
+	float GetTotalTime() const;
+
+	/** Pans the view when the user moves the scroll bar. */
+	void OnUserScrolled(float ScrollOffsetFraction);
+
 	/** The timeline the user chose for this panel. */
 	UNTimelineManagerDecorator* CurrentTimeline = nullptr;
 
@@ -124,16 +253,31 @@ private:
 	FName CurrentTimelineName = NAME_None;
 
 	/**
-	 * This is used for tooltip when mouse move.
+	 * The UID of the event under the mouse, with the tooltip it displays.
 	 * @see SNTimeline::OnMouseMove()
 	 */
-	int32 CurrentSlotNum = -1;
+	FGuid HoveredEventUID;
 
-	/**
-	* This is used for tooltip when mouse move.
-	* @see SNTimeline::OnMouseMove()
-	*/
-	int32 CurrentRowNum = -1;
+	/** @see HoveredEventUID */
+	FText HoveredTooltip;
+
+	/** The zoom, in pixels per second. @see OnMouseWheel() */
+	float UnitSecs = DefaultUnitSecs;
+
+	/** The time at the left of the widget. @see OnMouseMove(), OnUserScrolled() */
+	float ViewStartTime = 0.f;
+
+	/** @see FArguments::ExternalScrollbar */
+	TSharedPtr<SScrollBar> ExternalScrollbar;
+
+	/** @see ShowTrace() */
+	TSharedPtr<FNTimelineTrace> Trace;
+
+	/** The layout of Trace, @see LayOutTrace() */
+	TSharedPtr<FTimelineData> TraceData;
+
+	/** @see SetScrubTime() */
+	float ScrubTime = 0.f;
 
 	/** @see SNTimeline::Construct() */
 	FDelegateHandle DelegateStartGameHandle;
@@ -150,7 +294,7 @@ private:
 	 * - between windows instances
 	 * @see SNTimeline::OnPaint()
 	 */
-	static TMap<FName, FTimelineData> TimelineRows;
+	static TMap<FName, TSharedRef<FTimelineData>> TimelineRows;
 
 	/**
 	 * Informs SNTimeline::ComputeDesiredSize() if it should compute.
@@ -164,7 +308,24 @@ private:
 	static constexpr ESlateDrawEffect DrawEffects = ESlateDrawEffect::None;
 	static constexpr float TimelineHeight = 2.0f;
 	static constexpr float EventHeight = 10.f;
-	static constexpr float UnitSecs = 5.f;
+	static constexpr float DefaultUnitSecs = 5.f;
+	static constexpr float MinUnitSecs = 0.001f;
+	static constexpr float MaxUnitSecs = 1000.f;
+	/** The zoom factor of one wheel step */
+	static constexpr float ZoomStep = 1.25f;
+	static constexpr float RulerHeight = 12.f;
+	/** The min pixels between two graduations, to fit their time */
+	static constexpr float RulerMinStepWidth = 60.f;
+	/** The size of an endless event which has not started yet */
+	static constexpr float PendingEndlessSecs = 2.f;
 	static constexpr float MarginVertical = 2.f;
 	static constexpr float PaddingHorizontal = 1.f;
+	/** Where the first row is drawn */
+	static constexpr float RowsTop = RulerHeight + TimelineHeight + MarginVertical;
+	/** Slots smaller than this are drawn in density bars, @see SNTimeline::PaintRow() */
+	static constexpr float LodMinSlotWidth = 2.f;
+	/** The width of the area gathered in one density bar */
+	static constexpr float DensityBucketWidth = 4.f;
+	/** The number of slots making a density bar opaque */
+	static constexpr float DensityFullCount = 8.f;
 };
@@ -14,10 +14,16 @@
 
 #include "SWindowTimeline.h"
 
+#include "DesktopPlatformModule.h"
+#include "IDesktopPlatform.h"
 #include "SlateOptMacros.h"
 #include "SNTimeline.h"
 #include "TimelineGameSubsystem.h"
 #include "Config/TimelineConfig.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Misc/Paths.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SSlider.h"
 #include "Widgets/Layout/SScrollBox.h"
 
 #define LOCTEXT_NAMESPACE "NansTimelineSystemEd"
@@ -60,15 +66,51 @@ void SWindowTimeline::Construct(const FArguments& InArgs)
 		+ SVerticalBox::Slot() // The buttons row
 		.HAlign(HAlign_Center).VAlign(VAlign_Top).AutoHeight().Padding(10.f)
 		[
-			SAssignNew(TimelineComboBox, SComboBox<TSharedPtr<FName> >)
-			.OptionsSource(&TimelineNames)
-			.OnGenerateWidget(this, &SWindowTimeline::OnGenerateTimelineNamesComboBox)
-			.ContentPadding(2.0f)
-			.OnSelectionChanged(this, &SWindowTimeline::OnTimelineChanged)
-			.Content()
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth().Padding(2.f, 0.f)
+			[
+				SAssignNew(TimelineComboBox, SComboBox<TSharedPtr<FName> >)
+				.OptionsSource(&TimelineNames)
+				.OnGenerateWidget(this, &SWindowTimeline::OnGenerateTimelineNamesComboBox)
+				.ContentPadding(2.0f)
+				.OnSelectionChanged(this, &SWindowTimeline::OnTimelineChanged)
+				.Content()
+				[
+					SNew(STextBlock)
+					.Text(this, &SWindowTimeline::CreateTimelineNamesComboBoxContent)
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth().Padding(2.f, 0.f)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("ReplayTrace", "Replay"))
+				.ToolTipText(LOCTEXT("ReplayTraceTooltip", "Replays the last record of the chosen timeline"))
+				.OnClicked(this, &SWindowTimeline::OnReplayClicked)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth().Padding(2.f, 0.f)
 			[
-				SNew(STextBlock)
-				.Text(this, &SWindowTimeline::CreateTimelineNamesComboBoxContent)
+				SNew(SButton)
+				.Text(LOCTEXT("LiveTimeline", "Live"))
+				.ToolTipText(LOCTEXT("LiveTimelineTooltip", "Stops replaying and shows the chosen timeline"))
+				.Visibility(this, &SWindowTimeline::GetReplayVisibility)
+				.OnClicked(this, &SWindowTimeline::OnLiveClicked)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth().Padding(2.f, 0.f)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("SaveTrace", "Save trace..."))
+				.OnClicked(this, &SWindowTimeline::OnSaveTraceClicked)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth().Padding(2.f, 0.f)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("LoadTrace", "Load trace..."))
+				.OnClicked(this, &SWindowTimeline::OnLoadTraceClicked)
 			]
 		]
 		+ SVerticalBox::Slot() // The chosen timeline's name
@@ -92,20 +134,11 @@ void SWindowTimeline::Construct(const FArguments& InArgs)
 				.Orientation(Orient_Vertical)
 				.ExternalScrollbar(VerticalScrollBar)
 				+ SScrollBox::Slot()
-				.HAlign(HAlign_Left)
+				.HAlign(HAlign_Fill)
 				[
-					SNew(SScrollBox)
-					.Orientation(Orient_Horizontal)
+					// The timeline widget zooms and pans its time axis itself, it drives the horizontal scroll bar.
+					SAssignNew(TimelineWidget, SNTimeline)
 					.ExternalScrollbar(HorizontalScrollBar)
-					+ SScrollBox::Slot()
-					[
-						SNew(SBox)
-						.Padding(FMargin(0, 0, 0, 0))
-						.HAlign(HAlign_Left).VAlign(VAlign_Fill)
-						[
-							SAssignNew(TimelineWidget, SNTimeline)
-						]
-					]
 				]
 			]
 			+ SHorizontalBox::Slot()
@@ -119,6 +152,14 @@ void SWindowTimeline::Construct(const FArguments& InArgs)
 		[
 			HorizontalScrollBar.ToSharedRef()
 		]
+		+ SVerticalBox::Slot() // The scrub time of a replayed trace
+		.AutoHeight().Padding(20.f, 5.f)
+		[
+			SNew(SSlider)
+			.Visibility(this, &SWindowTimeline::GetReplayVisibility)
+			.Value(this, &SWindowTimeline::GetScrubValue)
+			.OnValueChanged(this, &SWindowTimeline::OnScrubValueChanged)
+		]
 	];
 
 	HorizontalScrollBar->SetState(0.0f, 1.0f);
@@ -162,7 +203,21 @@ FText SWindowTimeline::BuildText() const
 	ParentTabPtr->SetLabel(
 		FText::Format(LOCTEXT("Label_WindowTimeline_Named", "{0} Timeline"), FText::FromName(*CurrentTimeline))
 	);
-	if (!World)
+	const TSharedPtr<FNTimelineTrace> Trace = TimelineWidget.IsValid() ? TimelineWidget->GetShownTrace() : nullptr;
+	if (Trace.IsValid())
+	{
+		FNumberFormattingOptions Opts;
+		Opts.MinimumFractionalDigits = 2;
+		Opts.MaximumFractionalDigits = 2;
+		Text = FText::Format(
+			LOCTEXT("ReplayingTrace", "Replaying {0} timeline ({1}s / {2}s, {3} dropped records)"),
+			FText::FromName(Trace->TimelineName),
+			FText::AsNumber(TimelineWidget->GetScrubTime(), &Opts),
+			FText::AsNumber(Trace->GetDuration(), &Opts),
+			FText::AsNumber(Trace->GetNumDropped())
+		);
+	}
+	else if (!World)
 	{
 		Text = FText::Format(
 			LOCTEXT("NoGameWorld", "Need to play the game to debug {0} timeline"), FText::FromName(*CurrentTimeline)
@@ -241,18 +296,127 @@ void SWindowTimeline::OnTimelineChanged(TSharedPtr<FName> NewValue, ESelectInfo:
 	CurrentTimeline = NewValue;
 	UNTimelineManagerDecorator* Timeline = GetTimelineManager();
 
+	if (IsValid(Timeline))
+	{
+		Recorder.Start(Timeline);
+	}
+
 	if (TimelineWidget.IsValid())
 	{
 		TimelineWidget->ChangeTimeline(Timeline);
 
-		const float ThumbSizeFractionH = GetScrollBarSize(Orient_Horizontal);
-		HorizontalScrollBar->SetState(0.0f, ThumbSizeFractionH);
-
 		const float ThumbSizeFractionV = GetScrollBarSize(Orient_Vertical);
 		VerticalScrollBar->SetState(0.0f, ThumbSizeFractionV);
 	}
 }
 
+FReply SWindowTimeline::OnReplayClicked()
+{
+	if (Recorder.GetTrace().IsValid())
+	{
+		TimelineWidget->ShowTrace(Recorder.GetTrace());
+	}
+	return FReply::Handled();
+}
+
+FReply SWindowTimeline::OnLiveClicked()
+{
+	TimelineWidget->ShowTrace(nullptr);
+	return FReply::Handled();
+}
+
+TSharedPtr<FNTimelineTrace> SWindowTimeline::GetTraceToSave() const
+{
+	const TSharedPtr<FNTimelineTrace> Trace = TimelineWidget->GetShownTrace();
+	return Trace.IsValid() ? Trace : Recorder.GetTrace();
+}
+
+FReply SWindowTimeline::OnSaveTraceClicked()
+{
+	const TSharedPtr<FNTimelineTrace> Trace = GetTraceToSave();
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (!Trace.IsValid() || DesktopPlatform == nullptr)
+	{
+		return FReply::Handled();
+	}
+
+	TArray<FString> Filenames;
+	const FString FileTypes = FString::Printf(TEXT("Timeline trace (*.%s)|*.%s"), FNTimelineTrace::FileExtension, FNTimelineTrace::FileExtension);
+	const bool bIsChosen = DesktopPlatform->SaveFileDialog(
+		FSlateApplication::Get().FindBestParentWindowHandleForDialogs(AsShared()),
+		LOCTEXT("SaveTraceTitle", "Save timeline trace").ToString(),
+		FPaths::ProjectSavedDir(),
+		FString::Printf(TEXT("%s.%s"), *Trace->TimelineName.ToString(), FNTimelineTrace::FileExtension),
+		FileTypes,
+		EFileDialogFlags::None,
+		Filenames
+	);
+
+	if (bIsChosen && Filenames.Num() > 0 && !Trace->SaveToFile(Filenames[0]))
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s: can't write the trace in %s"), ANSI_TO_TCHAR(__FUNCTION__), *Filenames[0]);
+	}
+	return FReply::Handled();
+}
+
+FReply SWindowTimeline::OnLoadTraceClicked()
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (DesktopPlatform == nullptr)
+	{
+		return FReply::Handled();
+	}
+
+	TArray<FString> Filenames;
+	const FString FileTypes = FString::Printf(TEXT("Timeline trace (*.%s)|*.%s"), FNTimelineTrace::FileExtension, FNTimelineTrace::FileExtension);
+	const bool bIsChosen = DesktopPlatform->OpenFileDialog(
+		FSlateApplication::Get().FindBestParentWindowHandleForDialogs(AsShared()),
+		LOCTEXT("LoadTraceTitle", "Load timeline trace").ToString(),
+		FPaths::ProjectSavedDir(),
+		TEXT(""),
+		FileTypes,
+		EFileDialogFlags::None,
+		Filenames
+	);
+	if (!bIsChosen || Filenames.Num() <= 0)
+	{
+		return FReply::Handled();
+	}
+
+	const TSharedPtr<FNTimelineTrace> Trace = FNTimelineTrace::LoadFromFile(Filenames[0]);
+	if (!Trace.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s: %s is not a timeline trace"), ANSI_TO_TCHAR(__FUNCTION__), *Filenames[0]);
+		return FReply::Handled();
+	}
+	TimelineWidget->ShowTrace(Trace);
+	return FReply::Handled();
+}
+
+EVisibility SWindowTimeline::GetReplayVisibility() const
+{
+	return TimelineWidget.IsValid() && TimelineWidget->GetShownTrace().IsValid() ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+float SWindowTimeline::GetScrubValue() const
+{
+	const TSharedPtr<FNTimelineTrace> Trace = TimelineWidget.IsValid() ? TimelineWidget->GetShownTrace() : nullptr;
+	if (!Trace.IsValid() || Trace->GetDuration() <= 0.f)
+	{
+		return 1.f;
+	}
+	return TimelineWidget->GetScrubTime() / Trace->GetDuration();
+}
+
+void SWindowTimeline::OnScrubValueChanged(float NewValue)
+{
+	const TSharedPtr<FNTimelineTrace> Trace = TimelineWidget->GetShownTrace();
+	if (Trace.IsValid())
+	{
+		TimelineWidget->SetScrubTime(NewValue * Trace->GetDuration());
+	}
+}
+
 END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 #undef LOCTEXT_NAMESPACE
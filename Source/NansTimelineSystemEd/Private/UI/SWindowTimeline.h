@@ -16,6 +16,7 @@
 
 #include "CoreMinimal.h"
 #include "Manager/TimelineManagerDecorator.h"
+#include "Trace/TimelineTraceRecorder.h"
 
 #include "Widgets/SCompoundWidget.h"
 
@@ -65,11 +66,35 @@ private:
 	/** Listener of the FWorldDelegates::OnStartGameInstance to notify the timeline widget.  */
 	void OnGameInstanceStart(UGameInstance* GI);
 
+	/** Replays the trace recorded from the chosen timeline. */
+	FReply OnReplayClicked();
+
+	/** Goes back from a replayed trace to the chosen timeline. */
+	FReply OnLiveClicked();
+
+	/** Saves the replayed trace, or the recorded one, in a file chosen by the user. */
+	FReply OnSaveTraceClicked();
+
+	/** Replays a trace from a file chosen by the user. */
+	FReply OnLoadTraceClicked();
+
+	/** The trace Save button works with, nullptr if there is none. */
+	TSharedPtr<FNTimelineTrace> GetTraceToSave() const;
+
+	/** The scrub slider and the Live button are only visible while replaying. */
+	EVisibility GetReplayVisibility() const;
+
+	/** @returns the scrub time of the replayed trace as a fraction of its duration */
+	float GetScrubValue() const;
+
+	/** Moves the scrub time of the replayed trace, @see SNTimeline::SetScrubTime() */
+	void OnScrubValueChanged(float NewValue);
+
 	/** List of timelines names configured by user in plugin's config.  */
 	TArray<TSharedPtr<FName>> TimelineNames;
 	/** Timeline panel displaying events and time */
 	TSharedPtr<SNTimeline> TimelineWidget;
-	/** Horizontal scroll bar, used for scrolling timeline graphs. */
+	/** Horizontal scroll bar, it pans the time axis of TimelineWidget. */
 	TSharedPtr<SScrollBar> HorizontalScrollBar;
 	/** Vertical scroll bar, used for scrolling timeline graphs. */
 	TSharedPtr<SScrollBar> VerticalScrollBar;
@@ -77,6 +102,8 @@ private:
 	TSharedPtr<FName> CurrentTimeline = MakeShared<FName>(NAME_None);
 	/** The combobox widget of the timelines choices */
 	TSharedPtr<SComboBox<TSharedPtr<FName>>> TimelineComboBox;
+	/** Records the chosen timeline while the game plays, to replay it once the game ended. */
+	FNTimelineTraceRecorder Recorder;
 
 	TSharedPtr<SDockTab> ParentTabPtr;
 };
@@ -14,6 +14,8 @@
 
 #include "Event/EventBase.h"
 
+#include "Event/EventDispatchTable.h"
+
 #define CHECK_EVENT_V() if (!ensureMsgf(Event.IsValid(), TEXT("An NEvent object is mandatory! Please use Init before anything else!"))) return;
 #define CHECK_EVENT(ReturnValue) if (!ensureMsgf(Event.IsValid(), TEXT("An NEvent object is mandatory! Please use Init before anything else!"))) return ReturnValue;
 
@@ -24,6 +26,21 @@ void UNEventBase::Init(const TSharedPtr<INEvent>& InEvent, const float& InLocalT
 	OnInit(InLocalTime, InWorld, InPlayer);
 }
 
+void UNEventBase::Release()
+{
+	Event.Reset();
+}
+
+void UNEventBase::Restore(const TSharedPtr<INEvent>& InEvent)
+{
+	Event = InEvent;
+}
+
+bool UNEventBase::ImplementsHook(const ENTimelineEvent& EventName) const
+{
+	return FNEventDispatchTable::FindOrBuild(GetClass()).GetFunction(EventName) != nullptr;
+}
+
 bool UNEventBase::IsExpired() const
 {
 	CHECK_EVENT(false);
@@ -66,6 +83,12 @@ FString UNEventBase::GetUID() const
 	return Event->GetUID();
 }
 
+FGuid UNEventBase::GetGUID() const
+{
+	CHECK_EVENT(FGuid());
+	return Event->GetGUID();
+}
+
 float UNEventBase::GetAttachedTime() const
 {
 	CHECK_EVENT(0);
@@ -0,0 +1,95 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Event/EventDispatchTable.h"
+
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Event/EventBase.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+	TMap<TWeakObjectPtr<const UClass>, FNEventDispatchTable> Tables;
+	FDelegateHandle ObjectsReplacedHandle;
+	FDelegateHandle ReloadCompleteHandle;
+	FSimpleMulticastDelegate ResetDelegate;
+}
+
+const FNEventDispatchTable& FNEventDispatchTable::FindOrBuild(const UClass* Class)
+{
+	if (const FNEventDispatchTable* Table = Tables.Find(Class))
+	{
+		return *Table;
+	}
+
+	// In the ENTimelineEvent order
+	static const FName HookNames[FNTimeline::NumEventNames] = {
+		GET_FUNCTION_NAME_CHECKED(UNEventBase, OnBeforeAttached),
+		GET_FUNCTION_NAME_CHECKED(UNEventBase, OnAfterAttached),
+		GET_FUNCTION_NAME_CHECKED(UNEventBase, OnExpired),
+		GET_FUNCTION_NAME_CHECKED(UNEventBase, OnStart),
+		GET_FUNCTION_NAME_CHECKED(UNEventBase, OnTick),
+	};
+
+	FNEventDispatchTable& Table = Tables.Add(Class);
+	for (int32 Idx = 0; Idx < FNTimeline::NumEventNames; Idx++)
+	{
+		// A BlueprintImplementableEvent always exists, it is only implemented if a blueprint class overrides it.
+		UFunction* Func = Class->FindFunctionByName(HookNames[Idx]);
+		if (Func != nullptr && Func->GetOuter()->IsA(UBlueprintGeneratedClass::StaticClass()))
+		{
+			Table.Functions[Idx] = Func;
+		}
+	}
+	return Table;
+}
+
+void FNEventDispatchTable::Reset()
+{
+	Tables.Empty();
+	ResetDelegate.Broadcast();
+}
+
+FSimpleMulticastDelegate& FNEventDispatchTable::OnReset()
+{
+	return ResetDelegate;
+}
+
+void FNEventDispatchTable::RegisterInvalidation()
+{
+#if WITH_EDITOR
+	// Blueprint compilation creates new UFunctions and reinstances objects of the recompiled class.
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda(
+		[](const TMap<UObject*, UObject*>& ReplacementMap)
+		{
+			Reset();
+		}
+	);
+#endif
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda(
+		[](EReloadCompleteReason Reason)
+		{
+			Reset();
+		}
+	);
+}
+
+void FNEventDispatchTable::UnregisterInvalidation()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+#endif
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	Reset();
+}
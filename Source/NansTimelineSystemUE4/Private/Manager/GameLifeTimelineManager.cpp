@@ -46,6 +46,34 @@ void UNGameLifeTimelineManager::GameTimerTick()
 	SaveTime = NewTime;
 }
 
+void UNGameLifeTimelineManager::SetTickDriven(const bool& bInTickDriven)
+{
+	Super::SetTickDriven(bInTickDriven);
+	if (!IsValid(GetWorld())) return;
+
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	if (bInTickDriven)
+	{
+		TimerManager.ClearTimer(TimerHandle);
+	}
+	else if (TimerDelegate.IsBound())
+	{
+		TimerManager.SetTimer(TimerHandle, TimerDelegate, GetTimeline()->GetTickInterval(), true);
+	}
+}
+
+bool UNGameLifeTimelineManager::ConsumeTickDelta(const float& DeltaTime, float& OutDeltaTime)
+{
+	if (GetWorld() == nullptr) return false;
+
+	const float NewTime = GetWorld()->GetTimeSeconds();
+	if (NewTime - SaveTime < GetTimeline()->GetTickInterval()) return false;
+
+	OutDeltaTime = NewTime - SaveTime;
+	SaveTime = NewTime;
+	return true;
+}
+
 void UNGameLifeTimelineManager::BeginDestroy()
 {
 	if (IsValid(GetWorld()))
@@ -26,23 +26,64 @@ void UNRealLifeTimelineManager::Init(const float& InTickInterval, const FName& I
 		CreationTime = FDateTime::Now();
 	}
 	LastPlayTime = FDateTime::Now();
+	RealTime.Reset();
+	OnCatchUpProgressed().AddUObject(this, &UNRealLifeTimelineManager::OnCatchUpProgressedDelegate);
+	OnCatchUpCompleted().AddUObject(this, &UNRealLifeTimelineManager::OnCatchUpCompletedDelegate);
+}
+
+void UNRealLifeTimelineManager::OnCatchUpProgressedDelegate(const float& Progress)
+{
+	OnCatchUpProgress.Broadcast(Progress);
+}
+
+void UNRealLifeTimelineManager::OnCatchUpCompletedDelegate()
+{
+	OnCatchUpDone.Broadcast();
+}
+
+void UNRealLifeTimelineManager::SetClockSource(const TSharedRef<INClockSource>& InSource)
+{
+	RealTime.SetSource(InSource);
 }
 
 void UNRealLifeTimelineManager::Tick(float DeltaTime)
+{
+	float TickDelta;
+	if (ConsumeTickDelta(DeltaTime, TickDelta))
+	{
+		TimerTick(TickDelta);
+	}
+}
+
+bool UNRealLifeTimelineManager::ConsumeTickDelta(const float& DeltaTime, float& OutDeltaTime)
 {
 	// this ensure to always get the real time delta (in case of slowmo).
-	const float RealDelta = (FDateTime::Now() - LastPlayTime).GetTotalMilliseconds() / 1000;
-	if (RealDelta >= GetTimeline()->GetTickInterval())
+	// The clock is read once per frame, the time elapsed is kept until it is ticked.
+	const double RealDelta = RealTime.Sample();
+	if (IsCatchingUp())
 	{
-		TotalLifeTime += RealDelta;
-		TimerTick(RealDelta);
-		LastPlayTime = FDateTime::Now();
+		// The time spent meanwhile is replayed after the backlog, so events keep their order.
+		const float Delta = RealTime.Consume();
+		TotalLifeTime += Delta;
+		StartCatchUp(Delta);
+
+		FNTimelineCatchUpBudget Budget;
+		Budget.MaxTicks = CatchUpTicksPerFrame;
+		Budget.MaxMilliseconds = CatchUpMillisecondsPerFrame;
+		CatchUp(Budget);
+		return false;
 	}
+
+	if (RealDelta < GetTimeline()->GetTickInterval()) return false;
+
+	OutDeltaTime = RealTime.Consume();
+	TotalLifeTime += OutDeltaTime;
+	return true;
 }
 
 bool UNRealLifeTimelineManager::IsTickable() const
 {
-	return true;
+	return !bTickDriven;
 }
 
 UWorld* UNRealLifeTimelineManager::GetTickableGameObjectWorld() const
@@ -64,22 +105,35 @@ void UNRealLifeTimelineManager::Serialize(FArchive& Ar)
 		LastPlayTime = FDateTime::Now();
 	}
 
-	Ar << LastPlayTime;
+	// The time not ticked or not caught up with yet is saved as missing time, to be caught up after the next load.
+	FDateTime SavedPlayTime = LastPlayTime - FTimespan::FromSeconds(
+		GetTimeline()->GetCatchUpRemainingTime() + RealTime.GetAccumulated()
+	);
+	Ar << SavedPlayTime;
 
 	if (Ar.IsLoading())
 	{
+		LastPlayTime = SavedPlayTime;
 		// Recover time between creation and last save game
 		TotalLifeTime = (LastPlayTime - CreationTime).GetTotalSeconds();
 		// Recover lost time since last save game
 		float MissingLifeTime = (FDateTime::Now() - LastPlayTime).GetTotalSeconds();
 
-		// Tick to notify timeline until it reaches the actual time.
-		while (MissingLifeTime > 0)
+		if (bTimeSlicedCatchUp)
+		{
+			// Replayed tick by tick in the next frames, @see Tick()
+			StartCatchUp(MissingLifeTime);
+		}
+		// Catch up with the actual time at once, events start and expire as if it had been ticked meanwhile.
+		else if (MissingLifeTime > 0)
 		{
-			TimerTick(GetTimeline()->GetTickInterval());
-			MissingLifeTime -= GetTimeline()->GetTickInterval();
+			FNTimelineAdvancePolicy Policy;
+			Policy.bCoalesceTicks = bCoalesceCatchUpTicks;
+			AdvanceBy(MissingLifeTime, Policy);
 		}
 		TotalLifeTime += (FDateTime::Now() - LastPlayTime).GetTotalSeconds();
 		LastPlayTime = FDateTime::Now();
+		// The time elapsed before the load is replaced by the missing time
+		RealTime.Reset();
 	}
 }
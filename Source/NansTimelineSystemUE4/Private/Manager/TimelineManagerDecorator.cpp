@@ -15,7 +15,10 @@
 #include "Manager/TimelineManagerDecorator.h"
 
 #include "Event/EventBase.h"
+#include "Event/EventDispatchTable.h"
+#include "Engine/BlueprintGeneratedClass.h"
 #include "GameFramework/PlayerController.h"
+#include "Misc/ScopeExit.h"
 #include "UObject/ConstructorHelpers.h"
 #include "NansTimelineSystemUE4.h"
 
@@ -25,6 +28,10 @@ FString EnumToString(const ENTimelineEvent& Value)
 	return TypeEnum->GetNameStringByIndex(static_cast<int32>(Value));
 }
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Event hooks dispatched"), STAT_NansTimelineEventDispatches, STATGROUP_NansTimeline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Event pool hits"), STAT_NansTimelineEventPoolHits, STATGROUP_NansTimeline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Event pool misses"), STAT_NansTimelineEventPoolMisses, STATGROUP_NansTimeline);
+
 UNTimelineManagerDecorator::UNTimelineManagerDecorator() : FNTimelineManager() {}
 
 void UNTimelineManagerDecorator::Init(const float& InTickInterval, const FName& InLabel)
@@ -32,7 +39,46 @@ void UNTimelineManagerDecorator::Init(const float& InTickInterval, const FName&
 	ensureMsgf(GetWorld() != nullptr, TEXT("A UNTimelineManagerDecorator need a world to live"));
 	FNTimelineManager::Init(InTickInterval, InLabel);
 
+	UpdateHasBPEventChanged();
+
 	OnEventChanged().AddUObject(this, &UNTimelineManagerDecorator::OnEventChangedDelegate);
+	OnExpiredEventEvicted().AddUObject(this, &UNTimelineManagerDecorator::OnExpiredEventEvictedDelegate);
+	FNEventDispatchTable::OnReset().AddUObject(this, &UNTimelineManagerDecorator::OnDispatchTablesReset);
+}
+
+void UNTimelineManagerDecorator::OnExpiredEventEvictedDelegate(const FGuid& UID)
+{
+	UNEventBase* EventBase = nullptr;
+	ExpiredEventBases.RemoveAndCopyValue(UID, EventBase);
+	UnresolvedExpiredEventBases.Remove(UID);
+	if (ReleasedExpiredEventBases.Remove(UID) > 0 && IsValid(EventBase))
+	{
+		ReleaseEventBase(EventBase, GetCurrentTime());
+	}
+}
+
+void UNTimelineManagerDecorator::UpdateHasBPEventChanged()
+{
+	const UFunction* Func = GetClass()->FindFunctionByName(
+		GET_FUNCTION_NAME_CHECKED(UNTimelineManagerDecorator, OnBPEventChanged)
+	);
+	bHasBPEventChanged = Func != nullptr && Func->GetOuter()->IsA(UBlueprintGeneratedClass::StaticClass());
+}
+
+void UNTimelineManagerDecorator::OnDispatchTablesReset()
+{
+	// A recompiled blueprint can add or remove its OnBPEventChanged() implementation.
+	UpdateHasBPEventChanged();
+}
+
+void UNTimelineManagerDecorator::SetTickDriven(const bool& bInTickDriven)
+{
+	bTickDriven = bInTickDriven;
+}
+
+bool UNTimelineManagerDecorator::IsTickDriven() const
+{
+	return bTickDriven;
 }
 
 void UNTimelineManagerDecorator::Pause()
@@ -60,16 +106,20 @@ struct FParamsEventChanged
 void UNTimelineManagerDecorator::OnEventChangedDelegate(TSharedPtr<INEvent> Event,
 	const ENTimelineEvent& EventName, const float& LocalTime, const int32& Index)
 {
-	UNEventBase* EventBase = EventBases.FindRef(Event->GetUID());
+	const FGuid EventId = Event->GetGUID();
+	UNEventBase* EventBase = EventBases.FindRef(EventId);
 	if (!ensure(IsValid(EventBase)))
 	{
 		return;
 	}
 
-	OnBPEventChanged(EventBase, LocalTime);
+	if (bHasBPEventChanged)
+	{
+		OnBPEventChanged(EventBase, LocalTime);
+	}
 
-	FString FuncName = FString::Printf(TEXT("On%s"), *EnumToString(EventName));
-	UFunction* Func = EventBase->FindFunction(FName(FuncName));
+	// Hooks the event class doesn't implement are skipped, @see UNEventBase::ImplementsHook()
+	UFunction* Func = FNEventDispatchTable::FindOrBuild(EventBase->GetClass()).GetFunction(EventName);
 
 	if (Func != nullptr)
 	{
@@ -80,26 +130,66 @@ void UNTimelineManagerDecorator::OnEventChangedDelegate(TSharedPtr<INEvent> Even
 		Param.InPlayer = Param.InWorld->GetFirstPlayerController();
 
 		UE_DEBUG_LOG(
-			LogTimelineSystem, Display, TEXT("FuncName \"%s\" for event \"%s\" will be called at %f secs"), *FuncName,
-			*EventBase->GetEventLabel().ToString(), LocalTime
+			LogTimelineSystem, Display, TEXT("FuncName \"%s\" for event \"%s\" will be called at %f secs"),
+			*Func->GetName(), *EventBase->GetEventLabel().ToString(), LocalTime
 		);
+		INC_DWORD_STAT(STAT_NansTimelineEventDispatches);
 		EventBase->ProcessEvent(Func, &Param);
 	}
-	else
+
+	if (EventName == ENTimelineEvent::Expired)
 	{
-		UE_DEBUG_LOG(
-			LogTimelineSystem, Warning, TEXT("FuncName \"%s\" for event \"%s\" not exists"), *FuncName,
-			*EventBase->GetEventLabel().ToString()
-		);
+		EventBases.Remove(EventId);
+		ExpiredEventBases.Add(EventId, EventBase);
+		// The timeline pools the core event only if nothing else holds it, this one follows when it is evicted.
+		if (EventPoolCapacity > 0 && NumPooledEventBases < EventPoolCapacity)
+		{
+			EventBase->Release();
+			ReleasedExpiredEventBases.Add(EventId);
+		}
 	}
+}
 
-	if (EventName == ENTimelineEvent::Expired)
+void UNTimelineManagerDecorator::SetEventPoolCapacity(int32 InCapacity)
+{
+	EventPoolCapacity = FMath::Max(0, InCapacity);
+	GetTimeline()->SetPoolCapacity(EventPoolCapacity);
+	for (TTuple<UClass*, FNEventBasePool>& Pool : EventBasePools)
 	{
-		ExpiredEventBases.Add(Event->GetUID(), EventBase);
-		EventBases.Remove(Event->GetUID());
+		if (NumPooledEventBases <= EventPoolCapacity) break;
+		const int32 NumExtra = FMath::Min(NumPooledEventBases - EventPoolCapacity, Pool.Value.Events.Num());
+		Pool.Value.Events.SetNum(Pool.Value.Events.Num() - NumExtra);
+		NumPooledEventBases -= NumExtra;
 	}
 }
 
+UNEventBase* UNTimelineManagerDecorator::AcquireEventBase(UClass* Class)
+{
+	if (EventPoolCapacity > 0)
+	{
+		FNEventBasePool* Pool = EventBasePools.Find(Class);
+		if (Pool != nullptr && Pool->Events.Num() > 0)
+		{
+			INC_DWORD_STAT(STAT_NansTimelineEventPoolHits);
+			NumPooledEventBases--;
+			return Pool->Events.Pop(false);
+		}
+		INC_DWORD_STAT(STAT_NansTimelineEventPoolMisses);
+	}
+	return NewObject<UNEventBase>(this, Class);
+}
+
+bool UNTimelineManagerDecorator::ReleaseEventBase(UNEventBase* EventBase, const float& LocalTime)
+{
+	if (NumPooledEventBases >= EventPoolCapacity) return false;
+
+	EventBase->OnCleared(LocalTime, GetWorld(), GetWorld()->GetFirstPlayerController());
+	EventBase->Release();
+	EventBasePools.FindOrAdd(EventBase->GetClass()).Events.Add(EventBase);
+	NumPooledEventBases++;
+	return true;
+}
+
 TArray<UNEventBase*> UNTimelineManagerDecorator::GetEvents() const
 {
 	TArray<UNEventBase*> EventRecords;
@@ -110,18 +200,76 @@ TArray<UNEventBase*> UNTimelineManagerDecorator::GetEvents() const
 TArray<UNEventBase*> UNTimelineManagerDecorator::GetExpiredEvents() const
 {
 	TArray<UNEventBase*> EventRecords;
-	ExpiredEventBases.GenerateValueArray(EventRecords);
+	EventRecords.Reserve(ExpiredEventBases.Num());
+	for (const TTuple<FGuid, UNEventBase*>& Pair : ExpiredEventBases)
+	{
+		if (UNEventBase* EventBase = ResolveExpiredEventBase(Pair.Key))
+		{
+			EventRecords.Add(EventBase);
+		}
+	}
 	return EventRecords;
 }
 
+UNEventBase* UNTimelineManagerDecorator::ResolveExpiredEventBase(const FGuid& UID) const
+{
+	UNEventBase* EventBase = ExpiredEventBases.FindRef(UID);
+	if (EventBase != nullptr && ReleasedExpiredEventBases.Contains(UID))
+	{
+		// The core event is still in its slot until the end of the tick, then it is pooled or kept in the history.
+		TSharedPtr<INEvent> Event = Timeline->GetExpiredEvent(UID);
+		if (!Event.IsValid())
+		{
+			Event = Timeline->GetEvent(UID);
+		}
+		if (!Event.IsValid())
+		{
+			// Pooled, this one is evicted too.
+			return nullptr;
+		}
+		ReleasedExpiredEventBases.Remove(UID);
+		EventBase->Restore(Event);
+		return EventBase;
+	}
+	if (EventBase == nullptr || UnresolvedExpiredEventBases.Remove(UID) == 0)
+	{
+		return EventBase;
+	}
+
+	const TSharedPtr<INEvent> Event = Timeline->GetExpiredEvent(UID);
+	if (!ensureMsgf(
+		Event.IsValid(), TEXT("Event with Uid (\"%s\") can't be retrieved after serialization."), *UID.ToString()
+	))
+	{
+		return nullptr;
+	}
+
+	EventBase->Init(Event, ExpiredEventBasesLoadTime, GetWorld(), GetWorld()->GetFirstPlayerController());
+	return EventBase;
+}
+
 UNEventBase* UNTimelineManagerDecorator::GetEvent(const FString& InUID) const
+{
+	FGuid Id;
+	if (!FGuid::Parse(InUID, Id)) return nullptr;
+	return GetEvent(Id);
+}
+
+UNEventBase* UNTimelineManagerDecorator::GetEvent(const FGuid& InUID) const
 {
 	return EventBases.FindRef(InUID);
 }
 
 UNEventBase* UNTimelineManagerDecorator::GetExpiredEvent(const FString& InUID) const
 {
-	return ExpiredEventBases.FindRef(InUID);
+	FGuid Id;
+	if (!FGuid::Parse(InUID, Id)) return nullptr;
+	return GetExpiredEvent(Id);
+}
+
+UNEventBase* UNTimelineManagerDecorator::GetExpiredEvent(const FGuid& InUID) const
+{
+	return ResolveExpiredEventBase(InUID);
 }
 
 float UNTimelineManagerDecorator::GetCurrentTime() const
@@ -130,6 +278,18 @@ float UNTimelineManagerDecorator::GetCurrentTime() const
 	return GetTimeline()->GetCurrentTime();
 }
 
+bool UNTimelineManagerDecorator::IsCatchingUp() const
+{
+	check(GetTimeline().IsValid());
+	return GetTimeline()->IsCatchingUp();
+}
+
+float UNTimelineManagerDecorator::GetCatchUpProgress() const
+{
+	check(GetTimeline().IsValid());
+	return GetTimeline()->GetCatchUpProgress();
+}
+
 FName UNTimelineManagerDecorator::GetLabel() const
 {
 	check(GetTimeline().IsValid());
@@ -158,17 +318,33 @@ UNEventBase* UNTimelineManagerDecorator::CreateAndAddNewEvent(FName InName, TSub
 	const TSharedPtr<INEvent> Object = CreateNewEvent(InName, InDuration, InDelay);
 	if (!Object.IsValid()) return nullptr;
 
-	UNEventBase* Event = NewObject<UNEventBase>(this, ChildClass);
+	UNEventBase* Event = AcquireEventBase(ChildClass);
 	Event->Init(Object, GetCurrentTime(), GetWorld(), GetWorld()->GetFirstPlayerController());
-	EventBases.Add(Object->GetUID(), Event);
+	EventBases.Add(Object->GetGUID(), Event);
 
 	GetTimeline()->Attached(Object);
 	return Event;
 }
 
+bool UNTimelineManagerDecorator::AttachSubmission(const TSharedPtr<INEvent>& Event)
+{
+	// Drained on the ticking thread, so the UObject can be created here. Queued events have no class to choose.
+	UNEventBase* EventBase = AcquireEventBase(UNEventBase::StaticClass());
+	EventBase->Init(Event, GetCurrentTime(), GetWorld(), GetWorld()->GetFirstPlayerController());
+	EventBases.Add(Event->GetGUID(), EventBase);
+
+	if (!FNTimelineManager::AttachSubmission(Event))
+	{
+		EventBases.Remove(Event->GetGUID());
+		ReleaseEventBase(EventBase, GetCurrentTime());
+		return false;
+	}
+	return true;
+}
+
 void UNTimelineManagerDecorator::Clear()
 {
-	for (const TTuple<FString, UNEventBase*>& Event : EventBases)
+	for (const TTuple<FGuid, UNEventBase*>& Event : EventBases)
 	{
 		if (IsValid(GetWorld()))
 		{
@@ -181,7 +357,15 @@ void UNTimelineManagerDecorator::Clear()
 	}
 	EventBases.Empty();
 	ExpiredEventBases.Empty();
+	UnresolvedExpiredEventBases.Empty();
+	ReleasedExpiredEventBases.Empty();
 	FNTimelineManager::Clear();
+	EventBasesReset.Broadcast();
+}
+
+FSimpleMulticastDelegate& UNTimelineManagerDecorator::OnEventBasesReset()
+{
+	return EventBasesReset;
 }
 
 void UNTimelineManagerDecorator::Serialize(FArchive& Ar)
@@ -189,7 +373,113 @@ void UNTimelineManagerDecorator::Serialize(FArchive& Ar)
 	// Thanks to the UE4 serializing system, this will serialize all uproperty with "SaveGame"
 	Super::Serialize(Ar);
 	Archive(Ar);
+	ON_SCOPE_EXIT
+	{
+		if (Ar.IsLoading())
+		{
+			EventBasesReset.Broadcast();
+		}
+	};
 
+	// The timeline archive has set the version of its format.
+	if (Ar.CustomVer(FNTimelineArchive::VersionGUID) < static_cast<int32>(ENTimelineArchiveVersion::Compact))
+	{
+		SerializeLegacyEventBases(Ar);
+		return;
+	}
+
+	int32 NumEntries = EventBases.Num();
+	int32 NumExpiredEntries = ExpiredEventBases.Num();
+	Ar << NumEntries;
+	Ar << NumExpiredEntries;
+
+	// Each class path is written once, entries refer to it by index.
+	TArray<FString> ClassPaths;
+	if (Ar.IsSaving())
+	{
+		TMap<UClass*, int32> ClassIndexes;
+		auto CollectClasses = [&ClassPaths, &ClassIndexes](const TMap<FGuid, UNEventBase*>& Entries)
+		{
+			for (const TTuple<FGuid, UNEventBase*>& Pair : Entries)
+			{
+				UClass* Class = Pair.Value->GetClass();
+				if (!ClassIndexes.Contains(Class))
+				{
+					ClassIndexes.Add(Class, ClassPaths.Add(Class->GetPathName()));
+				}
+			}
+		};
+		auto SaveEntries = [&Ar, &ClassIndexes](const TMap<FGuid, UNEventBase*>& Entries)
+		{
+			for (const TTuple<FGuid, UNEventBase*>& Pair : Entries)
+			{
+				FGuid Id = Pair.Key;
+				Ar << Id;
+				uint32 ClassIndex = ClassIndexes.FindChecked(Pair.Value->GetClass());
+				Ar.SerializeIntPacked(ClassIndex);
+				Pair.Value->Serialize(Ar);
+			}
+		};
+
+		CollectClasses(EventBases);
+		CollectClasses(ExpiredEventBases);
+		Ar << ClassPaths;
+		SaveEntries(EventBases);
+		SaveEntries(ExpiredEventBases);
+		return;
+	}
+
+	Ar << ClassPaths;
+	ExpiredEventBasesLoadTime = GetCurrentTime();
+	UnresolvedExpiredEventBases.Reserve(NumExpiredEntries);
+	TArray<UClass*> Classes;
+	Classes.Reserve(ClassPaths.Num());
+	for (const FString& PathClass : ClassPaths)
+	{
+		Classes.Add(ConstructorHelpersInternal::FindOrLoadClass(PathClass, UNEventBase::StaticClass()));
+	}
+
+	for (int32 I = 0; I < NumEntries + NumExpiredEntries; I++)
+	{
+		const bool bIsExpired = I >= NumEntries;
+		FGuid EventId;
+		Ar << EventId;
+		uint32 ClassIndex = 0;
+		Ar.SerializeIntPacked(ClassIndex);
+		if (!Classes.IsValidIndex(ClassIndex) || Classes[ClassIndex] == nullptr)
+		{
+			Ar.SetError();
+			return;
+		}
+
+		// The object is always read to keep reading the next entries.
+		UNEventBase* Object = NewObject<UNEventBase>(this, Classes[ClassIndex]);
+		Object->Serialize(Ar);
+
+		// Resolving the core event would read its record, the timeline loads expired records lazily.
+		if (bIsExpired)
+		{
+			ExpiredEventBases.Emplace(EventId, Object);
+			UnresolvedExpiredEventBases.Add(EventId);
+			continue;
+		}
+
+		TSharedPtr<INEvent> Event = Timeline->GetEvent(EventId);
+		if (!ensureMsgf(
+			Event.IsValid(), TEXT("Event with Uid (\"%s\") can't be retrieved during serialization."),
+			*EventId.ToString()
+		))
+		{
+			continue;
+		}
+
+		Object->Init(Event, GetCurrentTime(), GetWorld(), GetWorld()->GetFirstPlayerController());
+		EventBases.Emplace(EventId, Object);
+	}
+}
+
+void UNTimelineManagerDecorator::SerializeLegacyEventBases(FArchive& Ar)
+{
 	int32 NumEntries = 0;
 	int32 NumExpiredEntries = 0;
 
@@ -202,11 +492,13 @@ void UNTimelineManagerDecorator::Serialize(FArchive& Ar)
 	Ar << NumEntries;
 	Ar << NumExpiredEntries;
 
+	// Ids are kept as strings to stay compatible with previous saves.
 	if (Ar.IsSaving() && NumEntries > 0)
 	{
-		for (TTuple<FString, UNEventBase*> Pair : EventBases)
+		for (const TTuple<FGuid, UNEventBase*>& Pair : EventBases)
 		{
-			Ar << Pair.Key;
+			FString Id = Pair.Key.ToString();
+			Ar << Id;
 			FString PathClass = Pair.Value->GetClass()->GetPathName();
 			Ar << PathClass;
 			Pair.Value->Serialize(Ar);
@@ -215,9 +507,10 @@ void UNTimelineManagerDecorator::Serialize(FArchive& Ar)
 
 	if (Ar.IsSaving() && NumExpiredEntries > 0)
 	{
-		for (TTuple<FString, UNEventBase*> Pair : ExpiredEventBases)
+		for (const TTuple<FGuid, UNEventBase*>& Pair : ExpiredEventBases)
 		{
-			Ar << Pair.Key;
+			FString Id = Pair.Key.ToString();
+			Ar << Id;
 			FString PathClass = Pair.Value->GetClass()->GetPathName();
 			Ar << PathClass;
 			Pair.Value->Serialize(Ar);
@@ -232,7 +525,9 @@ void UNTimelineManagerDecorator::Serialize(FArchive& Ar)
 			Ar << Id;
 			Ar << PathClass;
 
-			TSharedPtr<INEvent> Event = Timeline->GetEvent(Id);
+			FGuid EventId;
+			FGuid::Parse(Id, EventId);
+			TSharedPtr<INEvent> Event = Timeline->GetEvent(EventId);
 
 			if (ensureMsgf(
 				Event.IsValid(), TEXT("Event with Uid (\"%s\") can't be retrieved during serialization."), *Id
@@ -242,7 +537,7 @@ void UNTimelineManagerDecorator::Serialize(FArchive& Ar)
 				UNEventBase* Object = NewObject<UNEventBase>(this, Class);
 				Object->Serialize(Ar);
 				Object->Init(Event, GetCurrentTime(), GetWorld(), GetWorld()->GetFirstPlayerController());
-				EventBases.Emplace(Id, Object);
+				EventBases.Emplace(EventId, Object);
 			}
 		}
 	}
@@ -255,7 +550,9 @@ void UNTimelineManagerDecorator::Serialize(FArchive& Ar)
 			Ar << Id;
 			Ar << PathClass;
 
-			TSharedPtr<INEvent> Event = Timeline->GetExpiredEvent(Id);
+			FGuid EventId;
+			FGuid::Parse(Id, EventId);
+			TSharedPtr<INEvent> Event = Timeline->GetExpiredEvent(EventId);
 
 			if (ensureMsgf(
 				Event.IsValid(), TEXT("Event with Uid (\"%s\") can't be retrieved during serialization."), *Id
@@ -265,7 +562,7 @@ void UNTimelineManagerDecorator::Serialize(FArchive& Ar)
 				UNEventBase* Object = NewObject<UNEventBase>(this, Class);
 				Object->Serialize(Ar);
 				Object->Init(Event, GetCurrentTime(), GetWorld(), GetWorld()->GetFirstPlayerController());
-				ExpiredEventBases.Emplace(Id, Object);
+				ExpiredEventBases.Emplace(EventId, Object);
 			}
 		}
 	}
@@ -274,6 +571,11 @@ void UNTimelineManagerDecorator::Serialize(FArchive& Ar)
 void UNTimelineManagerDecorator::BeginDestroy()
 {
 	OnEventChanged().RemoveAll(this);
+	OnExpiredEventEvicted().RemoveAll(this);
+	FNEventDispatchTable::OnReset().RemoveAll(this);
+	OnCatchUpProgressed().RemoveAll(this);
+	OnCatchUpCompleted().RemoveAll(this);
 	Clear();
+	EventBasesReset.Clear();
 	Super::BeginDestroy();
 }
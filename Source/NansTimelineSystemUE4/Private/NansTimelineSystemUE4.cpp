@@ -14,13 +14,21 @@
 
 #include "NansTimelineSystemUE4.h"
 
+#include "Event/EventDispatchTable.h"
+
 DEFINE_LOG_CATEGORY(LogTimelineSystem);
 
 #define LOCTEXT_NAMESPACE "FNansTimelineSystemUE4Module"
 
-void FNansTimelineSystemUE4Module::StartupModule() {}
+void FNansTimelineSystemUE4Module::StartupModule()
+{
+	FNEventDispatchTable::RegisterInvalidation();
+}
 
-void FNansTimelineSystemUE4Module::ShutdownModule() {}
+void FNansTimelineSystemUE4Module::ShutdownModule()
+{
+	FNEventDispatchTable::UnregisterInvalidation();
+}
 
 #undef LOCTEXT_NAMESPACE
 
@@ -17,6 +17,7 @@
 #include "Config/TimelineConfig.h"
 #include "Manager/TimelineManagerDecorator.h"
 #include "NansTimelineSystemUE4.h"
+#include "TimelineTickDriver.h"
 
 UNTimelineClient::UNTimelineClient() {}
 
@@ -24,6 +25,11 @@ void UNTimelineClient::Init()
 {
 	TArray<FConfiguredTimelineConf> ConfigList;
 	UNTimelineConfig::GetConfigs(ConfigList);
+	if (GetDefault<UNTimelineConfig>()->bSharedTickDriver && TickDriver == nullptr)
+	{
+		TickDriver = NewObject<UNTimelineTickDriver>(this);
+		TickDriver->bParallelTick = GetDefault<UNTimelineConfig>()->bParallelTick;
+	}
 
 	for (auto& Conf : ConfigList)
 	{
@@ -32,7 +38,18 @@ void UNTimelineClient::Init()
 			this, Conf.TimelineClass, Conf.TickInterval, Conf.Name
 		);
 		Timeline->bDebug = Conf.bDebug;
+		Timeline->GetTimeline()->SetStorage(
+			Conf.bPackedEvents ? ENTimelineStorage::Packed : ENTimelineStorage::Objects
+		);
+		Timeline->SetEventPoolCapacity(Conf.EventPoolCapacity);
+		Timeline->GetTimeline()->SetExpiredEventsPolicy(Conf.GetExpiredEventsPolicy());
+		Timeline->GetTimeline()->SetArchivePackedTimes(Conf.bPackedSaveTimes);
+		Timeline->GetTimeline()->SetParallelSweepThreshold(Conf.ParallelSweepThreshold);
 		Timeline->Play();
+		if (TickDriver != nullptr)
+		{
+			TickDriver->Register(Timeline);
+		}
 
 		TimelinesCollection.Add(Conf.Name, Timeline);
 	}
@@ -72,6 +89,10 @@ void UNTimelineClient::Serialize(FArchive& Ar)
 	{
 		for (auto& It : TimelinesCollection)
 		{
+			if (TickDriver != nullptr)
+			{
+				TickDriver->Unregister(It.Value, false);
+			}
 			It.Value->ConditionalBeginDestroy();
 		}
 		// Refresh Timeline data, in case data has been set from previous load or during game play.
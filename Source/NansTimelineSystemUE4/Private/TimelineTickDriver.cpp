@@ -0,0 +1,127 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "TimelineTickDriver.h"
+
+#include "Algo/BinarySearch.h"
+#include "Manager/TimelineManagerDecorator.h"
+#include "NansTimelineSystemUE4.h"
+
+DECLARE_CYCLE_STAT(TEXT("Timelines tick"), STAT_NansTimelineTickDriver, STATGROUP_NansTimeline);
+
+void UNTimelineTickDriver::Register(UNTimelineManagerDecorator* Manager)
+{
+	check(Manager != nullptr);
+	if (Manager->IsTickDriven()) return;
+
+	const float TickInterval = Manager->GetTimeline()->GetTickInterval();
+	int32 GroupIndex = Algo::LowerBoundBy(Groups, TickInterval, &FNTimelineTickGroup::TickInterval);
+	if (!Groups.IsValidIndex(GroupIndex) || Groups[GroupIndex].TickInterval != TickInterval)
+	{
+		FNTimelineTickGroup Group;
+		Group.TickInterval = TickInterval;
+		Groups.Insert(MoveTemp(Group), GroupIndex);
+	}
+	Groups[GroupIndex].Managers.Add(Manager);
+	Manager->SetTickDriven(true);
+}
+
+void UNTimelineTickDriver::Unregister(UNTimelineManagerDecorator* Manager, const bool& bGiveBackTick)
+{
+	for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); GroupIndex++)
+	{
+		if (Groups[GroupIndex].Managers.Remove(Manager) == 0) continue;
+
+		if (Groups[GroupIndex].Managers.Num() == 0)
+		{
+			Groups.RemoveAt(GroupIndex);
+		}
+		if (bGiveBackTick)
+		{
+			Manager->SetTickDriven(false);
+		}
+		return;
+	}
+}
+
+int32 UNTimelineTickDriver::Num() const
+{
+	int32 Num = 0;
+	for (const FNTimelineTickGroup& Group : Groups)
+	{
+		Num += Group.Managers.Num();
+	}
+	return Num;
+}
+
+void UNTimelineTickDriver::Tick(float DeltaTime)
+{
+	// The due managers are collected first, a ticked manager can unregister others and change Groups.
+	Requests.Reset();
+	for (const FNTimelineTickGroup& Group : Groups)
+	{
+		for (UNTimelineManagerDecorator* Manager : Group.Managers)
+		{
+			// A manager destroyed without being unregistered
+			if (!IsValid(Manager) || Manager->HasAnyFlags(RF_BeginDestroyed)) continue;
+
+			float TickDelta;
+			if (!Manager->ConsumeTickDelta(DeltaTime, TickDelta)) continue;
+
+			Requests.Emplace(Manager, TickDelta);
+		}
+	}
+
+	if (bParallelTick && Requests.Num() > 1)
+	{
+		FNTimelineManager::TickInParallel(Requests);
+		return;
+	}
+
+	for (const FNTimelineTickRequest& Request : Requests)
+	{
+		// It may have been unregistered or destroyed by the tick of a previous one.
+		UNTimelineManagerDecorator* Manager = static_cast<UNTimelineManagerDecorator*>(Request.Manager);
+		if (!IsValid(Manager) || Manager->HasAnyFlags(RF_BeginDestroyed) || !Manager->IsTickDriven()) continue;
+
+		Manager->TimerTick(Request.DeltaTime);
+	}
+}
+
+bool UNTimelineTickDriver::IsTickable() const
+{
+	return Groups.Num() > 0 && !HasAnyFlags(RF_ClassDefaultObject | RF_BeginDestroyed);
+}
+
+TStatId UNTimelineTickDriver::GetStatId() const
+{
+	return GET_STATID(STAT_NansTimelineTickDriver);
+}
+
+UWorld* UNTimelineTickDriver::GetTickableGameObjectWorld() const
+{
+	if (GetWorld())
+	{
+		return GetWorld();
+	}
+	return nullptr;
+}
+
+void UNTimelineTickDriver::BeginDestroy()
+{
+	// Managers are destroyed with their owner, they don't need their own registration back.
+	Groups.Empty();
+	Super::BeginDestroy();
+}
@@ -21,6 +21,23 @@
 
 #include "TimelineConfig.generated.h"
 
+/** Blueprint version of ENExpiredEventsRetention, @see FNExpiredEventsPolicy */
+UENUM(BlueprintType)
+enum class ENTimelineExpiredRetention : uint8
+{
+	/** Every expired events are kept */
+	All,
+
+	/** Only the last MaxExpiredEvents expired events are kept */
+	Last,
+
+	/** Expired events are kept ExpiredEventsLifespan seconds after they expire */
+	Lifespan,
+
+	/** Expired events are dropped as soon as they expire */
+	None,
+};
+
 /**
  * This struct to create Configured Timeline and ease Timeline instantiation.
  * This allows to associated a Timeline Name to a class.
@@ -48,6 +65,57 @@ struct NANSTIMELINESYSTEMUE4_API FConfiguredTimelineConf
 	/** Will debug this timeline */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NansTimeline")
 	bool bDebug = false;
+
+	/**
+	 * Keeps core events data in contiguous arrays instead of one object per event,
+	 * this makes ticking many events cheaper. @see ENTimelineStorage::Packed
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NansTimeline")
+	bool bPackedEvents = false;
+
+	/**
+	 * Reuses expired events instead of creating new ones, 0 disables it.
+	 * @see UNTimelineManagerDecorator::SetEventPoolCapacity()
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NansTimeline", meta = (ClampMin = 0))
+	int32 EventPoolCapacity = 0;
+
+	/** Bounds the expired events kept by this timeline, this bounds its save size too. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NansTimeline")
+	ENTimelineExpiredRetention ExpiredEventsRetention = ENTimelineExpiredRetention::All;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NansTimeline", meta = (ClampMin = 0, EditCondition = "ExpiredEventsRetention == ENTimelineExpiredRetention::Last"))
+	int32 MaxExpiredEvents = 100;
+
+	/** In secs */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NansTimeline", meta = (ClampMin = 0, EditCondition = "ExpiredEventsRetention == ENTimelineExpiredRetention::Lifespan"))
+	float ExpiredEventsLifespan = 60.f;
+
+	/** Keeps a count and the times of evicted events. @see FNExpiredEventsSummary */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NansTimeline")
+	bool bSummarizeExpiredEvents = false;
+
+	/** Saves events times rounded to the millisecond, for smaller saves. @see FNTimeline::SetArchivePackedTimes() */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NansTimeline")
+	bool bPackedSaveTimes = false;
+
+	/**
+	 * Above this number of running events, they are advanced in parallel at each tick, 0 disables it.
+	 * @see FNTimeline::SetParallelSweepThreshold()
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NansTimeline", meta = (ClampMin = 0))
+	int32 ParallelSweepThreshold = FNTimeline::DefaultParallelSweepThreshold;
+
+	/** @returns the core policy from ExpiredEventsRetention, MaxExpiredEvents, ExpiredEventsLifespan & bSummarizeExpiredEvents */
+	FNExpiredEventsPolicy GetExpiredEventsPolicy() const
+	{
+		FNExpiredEventsPolicy Policy;
+		Policy.Retention = static_cast<ENExpiredEventsRetention>(ExpiredEventsRetention);
+		Policy.MaxEvents = MaxExpiredEvents;
+		Policy.Lifespan = ExpiredEventsLifespan;
+		Policy.bSummarize = bSummarizeExpiredEvents;
+		return Policy;
+	}
 };
 
 /**
@@ -61,6 +129,21 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "NansTimeline")
 	TArray<FConfiguredTimelineConf> ConfiguredTimeline;
 
+	/**
+	 * Ticks all the configured timelines in one pass, instead of each timeline registering its own tick.
+	 * Disabled by default as it changes when the timelines tick in the frame.
+	 * @see UNTimelineTickDriver
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "NansTimeline")
+	bool bSharedTickDriver = false;
+
+	/**
+	 * Ticks the timelines in parallel, their events are still notified on the game thread in a deterministic order.
+	 * @see FNTimelineManager::TickInParallel()
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "NansTimeline", meta = (EditCondition = "bSharedTickDriver"))
+	bool bParallelTick = false;
+
 	/**
 	 * Retrieve config from developers choices.
 	 */
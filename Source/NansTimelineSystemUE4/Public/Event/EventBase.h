@@ -17,6 +17,7 @@
 #include "CoreMinimal.h"
 
 #include "Event.h"
+#include "Timeline.h"
 #include "Engine/Blueprint.h"
 #include "EventBase.generated.h"
 
@@ -56,6 +57,8 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NansTimeline|Event")
 	virtual FString GetUID() const override;
 
+	virtual FGuid GetGUID() const override;
+
 	UFUNCTION(BlueprintCallable, Category = "NansTimeline|Event")
 	virtual float GetAttachedTime() const override;
 
@@ -77,6 +80,7 @@ public:
 	virtual void AddTime(const float& NewTime) override {}
 	virtual void Clear() override {}
 	virtual void Archive(FArchive& Ar) override {}
+	virtual void ArchiveRecord(FNTimelineArchive& Ar) override {}
 	// END INEvent overrides
 
 	/**
@@ -152,6 +156,19 @@ public:
 	virtual void BeginDestroy() override;
 	TSharedPtr<INEvent> GetEvent();
 
+	/** Drops the decorated event, this object can then be reused with Init(). */
+	void Release();
+
+	/** Decorates again the event dropped by Release(), without calling OnInit() as this is the same event. */
+	void Restore(const TSharedPtr<INEvent>& InEvent);
+
+	/**
+	 * @returns true if the class of this object implements in blueprint the hook
+	 * called for this notification (OnStart(), OnTick(), ...). It is read from the table of its class,
+	 * so it follows blueprint recompilation. @see FNEventDispatchTable
+	 */
+	bool ImplementsHook(const ENTimelineEvent& EventName) const;
+
 #if WITH_EDITOR
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "NansTimeline|Event|Debug")
 	FString GetDebugTooltipText() const;
@@ -0,0 +1,53 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Timeline.h"
+
+class UFunction;
+
+/**
+ * The blueprint hooks (OnStart(), OnTick()...) an UNEventBase class implements, by ENTimelineEvent.
+ * It is built once per class and dropped when a blueprint is recompiled or code is hot reloaded,
+ * so dispatching a notification needs neither a string nor a FindFunction().
+ */
+struct NANSTIMELINESYSTEMUE4_API FNEventDispatchTable
+{
+	/** nullptr when the hook is not implemented in blueprint */
+	UFunction* Functions[FNTimeline::NumEventNames] = {};
+
+	/** @returns the function to call for this notification, nullptr if there is nothing to call */
+	UFunction* GetFunction(const ENTimelineEvent& EventName) const
+	{
+		return Functions[static_cast<int32>(EventName)];
+	}
+
+	/** @returns the table of this UNEventBase class, it is built on first use. */
+	static const FNEventDispatchTable& FindOrBuild(const UClass* Class);
+
+	/** Drops every tables, they will be built again on next use. */
+	static void Reset();
+
+	/** Broadcasted by Reset(), so the state computed from a table can be computed again. */
+	static FSimpleMulticastDelegate& OnReset();
+
+	/** Registers to blueprint reinstancing & hot reload to reset the tables, called by the module startup. */
+	static void RegisterInvalidation();
+
+	/** @see RegisterInvalidation() */
+	static void UnregisterInvalidation();
+};
@@ -50,6 +50,12 @@ public:
 	 */
 	virtual void Init(const float& InTickInterval = 1.f, const FName& InLabel = NAME_None) override;
 
+	/** Clears the timer when driven, sets it again otherwise. */
+	virtual void SetTickDriven(const bool& bInTickDriven) override;
+
+	/** Consumes the game time elapsed since the last tick, when it reaches a tick interval. */
+	virtual bool ConsumeTickDelta(const float& DeltaTime, float& OutDeltaTime) override;
+
 	/** Clears timer + unbind delegate + invalidate handle. */
 	virtual void BeginDestroy() override;
 
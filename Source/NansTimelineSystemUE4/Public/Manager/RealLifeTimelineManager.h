@@ -15,11 +15,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ClockSource.h"
 #include "Runtime/Engine/Public/Tickable.h"
 #include "TimelineManagerDecorator.h"
 
 #include "RealLifeTimelineManager.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNCatchUpProgressedDynamicDelegate, float, Progress);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FNCatchUpCompletedDynamicDelegate);
+
 /**
  * It tracks realtime, it is not altered by pause or slowmo.
  *
@@ -54,14 +58,14 @@ public:
 		return true;
 	}
 
-	/** Always returns true 'cause it can be paused or stopped */
+	/** Always returns true 'cause it can be paused or stopped, unless it is ticked by a UNTimelineTickDriver */
 	virtual bool IsTickable() const override;
 
 	/**
 	 * This override methods allows to tick UNTimelineManagerDecorator::TimerTick()
 	 * and to increment times vars.
 	 *
-	 * @param DeltaTime - It is not used here, it used FDateTime::Now() - LastPlayTime to compute the real life delta time
+	 * @param DeltaTime - It is not used here, the real life delta time is given by the clock source. @see SetClockSource()
 	 */
 	virtual void Tick(float DeltaTime) override;
 
@@ -76,6 +80,9 @@ public:
 	virtual UWorld* GetTickableGameObjectWorld() const override;
 	// END FTickableGameObject override
 
+	/** Consumes the real time elapsed when it reaches a tick interval, or replays a frame of a time-sliced catch-up. */
+	virtual bool ConsumeTickDelta(const float& DeltaTime, float& OutDeltaTime) override;
+
 	/**
 	 * Used for save to retrieve last datetime and save it,
 	 * for load to compute missing time during last saves and ticks accordingly.
@@ -84,18 +91,64 @@ public:
 	 */
 	virtual void Serialize(FArchive& Ar) override;
 
+	/**
+	 * Changes the clock giving the real time elapsed between frames, a FNMonotonicClockSource is used by default.
+	 * The time missed between a save and a load is still computed with FDateTime::Now().
+	 */
+	void SetClockSource(const TSharedRef<INClockSource>& InSource);
+
 	/** It should be set only the first time the game is launched. */
 	UPROPERTY(BlueprintReadOnly, SaveGame)
 	FDateTime CreationTime;
 
+	/**
+	 * When the time missed since the last save is caught up on load,
+	 * running events are ticked once at the end instead of not at all. @see FNTimelineAdvancePolicy
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "NansTimeline|Manager")
+	bool bCoalesceCatchUpTicks = true;
+
+	/**
+	 * When true, the time missed since the last save is replayed tick by tick across frames
+	 * instead of at once on load, for handlers which have to run at each tick interval.
+	 * @see IsCatchingUp(), CatchUpTicksPerFrame, CatchUpMillisecondsPerFrame
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "NansTimeline|Manager")
+	bool bTimeSlicedCatchUp = false;
+
+	/** The max ticks replayed per frame by a time-sliced catch-up, 0 for no limit */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "NansTimeline|Manager")
+	int32 CatchUpTicksPerFrame = 0;
+
+	/** The max time spent per frame by a time-sliced catch-up in millisecs, 0 for no limit */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "NansTimeline|Manager")
+	float CatchUpMillisecondsPerFrame = 2.f;
+
+	/** Broadcast at each frame of a time-sliced catch-up with the ratio of the missed time already replayed */
+	UPROPERTY(BlueprintAssignable, Category = "NansTimeline|Manager")
+	FNCatchUpProgressedDynamicDelegate OnCatchUpProgress;
+
+	/** Broadcast when a time-sliced catch-up is done */
+	UPROPERTY(BlueprintAssignable, Category = "NansTimeline|Manager")
+	FNCatchUpCompletedDynamicDelegate OnCatchUpDone;
+
 protected:
 	/** It tracks time (secs) since it has been created */
 	float TotalLifeTime = 0;
-	/** It tracks time (FDateTime) since it has been created */
+	/** The wall clock time of the last init, save or load, to compute the time missed until the next load */
 	FDateTime LastPlayTime;
 
+	/** The real time elapsed and not ticked yet. @see SetClockSource() */
+	FNClockAccumulator RealTime;
+
 	/** Default ctor */
 	UNRealLifeTimelineManager();
 
+	/** Forwards FNTimelineManager::OnCatchUpProgressed() to OnCatchUpProgress */
+	void OnCatchUpProgressedDelegate(const float& Progress);
+
+	/** Forwards FNTimelineManager::OnCatchUpCompleted() to OnCatchUpDone */
+	void OnCatchUpCompletedDelegate();
+
 private:
 };
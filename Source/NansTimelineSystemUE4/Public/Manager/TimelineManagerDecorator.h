@@ -25,6 +25,16 @@ class UNEventBase;
 
 FString EnumToString(const ENTimelineEvent& Value);
 
+/** The released UNEventBase of one class, @see UNTimelineManagerDecorator::SetEventPoolCapacity() */
+USTRUCT()
+struct FNEventBasePool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<UNEventBase*> Events;
+};
+
 /**
  * This class is a factory to managed properly UNTimelineManagerDecorator instantiation.
  */
@@ -112,6 +122,16 @@ public:
 
 	void OnEventChangedDelegate(TSharedPtr<INEvent> Event, const ENTimelineEvent& EventName,
 		const float& LocalTime, const int32& Index);
+
+	/**
+	 * Keeps ExpiredEventBases in sync with the bounded history of the timeline. @see FNExpiredEventsPolicy
+	 * Released expired events are pooled here. @see ReleasedExpiredEventBases
+	 */
+	void OnExpiredEventEvictedDelegate(const FGuid& UID);
+
+	/** Updates bHasBPEventChanged, as this class may have been recompiled. @see FNEventDispatchTable::OnReset() */
+	void OnDispatchTablesReset();
+
 	/**
 	 * The embedded timeline is created as subobject in the ctor.
 	 * So this just to register the listener for FNTimelineManager::OnEventChange()
@@ -149,14 +169,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NansTimeline|Manager")
 	UNEventBase* GetEvent(const FString& InUID) const;
 
+	/** Get one event from EventBases by its UUID, nullptr if not found */
+	UNEventBase* GetEvent(const FGuid& InUID) const;
+
 	/** Get one expired event from ExpiredEventBases by its UUID, nullptr if not found */
 	UFUNCTION(BlueprintCallable, Category = "NansTimeline|Manager")
 	UNEventBase* GetExpiredEvent(const FString& InUID) const;
 
+	/** Get one expired event from ExpiredEventBases by its UUID, nullptr if not found */
+	UNEventBase* GetExpiredEvent(const FGuid& InUID) const;
+
 	/** A pass-through for the embedded FNTimeline::GetCurrentTime() */
 	UFUNCTION(BlueprintCallable, Category = "NansTimeline|Manager")
 	float GetCurrentTime() const;
 
+	/** A pass-through for the embedded FNTimeline::IsCatchingUp() */
+	UFUNCTION(BlueprintCallable, Category = "NansTimeline|Manager")
+	bool IsCatchingUp() const;
+
+	/** A pass-through for the embedded FNTimeline::GetCatchUpProgress() */
+	UFUNCTION(BlueprintCallable, Category = "NansTimeline|Manager")
+	float GetCatchUpProgress() const;
+
 	/** A pass-through for the embedded FNTimeline::GetLabel() */
 	UFUNCTION(BlueprintCallable, Category = "NansTimeline|Manager")
 	FName GetLabel() const;
@@ -184,6 +218,45 @@ public:
 	/** Remove all EventBases and ExpiredEventBases */
 	virtual void Clear() override;
 
+	/**
+	 * When driven, this manager doesn't register its own tick (timer, tickable...),
+	 * a UNTimelineTickDriver calls ConsumeTickDelta() at each frame and ticks it instead.
+	 */
+	virtual void SetTickDriven(const bool& bInTickDriven);
+
+	/** @see SetTickDriven() */
+	bool IsTickDriven() const;
+
+	/**
+	 * Called at each frame by its UNTimelineTickDriver.
+	 * It checks the time of this manager and consumes it when an interval elapsed.
+	 *
+	 * @param DeltaTime - The world delta time of the frame
+	 * @param OutDeltaTime - The delta to tick the timeline with
+	 * @returns true if the timeline should be ticked with OutDeltaTime
+	 */
+	virtual bool ConsumeTickDelta(const float& DeltaTime, float& OutDeltaTime)
+	{
+		return false;
+	}
+
+	/**
+	 * Enables events pooling when InCapacity > 0 (disabled by default).
+	 * An expired UNEventBase is then cleared (OnCleared() is called) and reused by CreateAndAddNewEvent()
+	 * for the same class, once the timeline has pooled its core event instead of keeping it in the history.
+	 * Don't keep any reference on an event after it expires in this mode.
+	 *
+	 * @param InCapacity - The max number of pooled objects, the same cap is used by the timeline for core events
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NansTimeline|Manager")
+	void SetEventPoolCapacity(int32 InCapacity);
+
+	/**
+	 * Broadcasted when EventBases and ExpiredEventBases are replaced at once, by Clear() or by loading,
+	 * without any event notification.
+	 */
+	FSimpleMulticastDelegate& OnEventBasesReset();
+
 protected:
 	/**
 	 * Protected ctor to force instantiation with CreateObject() methods (factory methods).
@@ -196,9 +269,71 @@ protected:
 
 	/** This is the decorated list of FNTimeline::Events */
 	UPROPERTY(SkipSerialization)
-	TMap<FString, UNEventBase*> EventBases;
+	TMap<FGuid, UNEventBase*> EventBases;
 
 	/** This is the decorated list of FNTimeline::ExpiredEvents */
 	UPROPERTY(SkipSerialization)
-	TMap<FString, UNEventBase*> ExpiredEventBases;
+	TMap<FGuid, UNEventBase*> ExpiredEventBases;
+
+	/** Released events by class. @see SetEventPoolCapacity() */
+	UPROPERTY(Transient)
+	TMap<UClass*, FNEventBasePool> EventBasePools;
+
+	/** @see SetEventPoolCapacity() */
+	int32 EventPoolCapacity = 0;
+
+	/** The number of events in all EventBasePools, capped by EventPoolCapacity */
+	int32 NumPooledEventBases = 0;
+
+	/**
+	 * Expired events which have dropped their core event so the timeline can pool it.
+	 * They are pooled when the timeline evicts their core event, @see OnExpiredEventEvictedDelegate(),
+	 * or they decorate it again when they are accessed in the history. @see ResolveExpiredEventBase()
+	 */
+	mutable TSet<FGuid> ReleasedExpiredEventBases;
+
+	/** @see SetTickDriven() */
+	bool bTickDriven = false;
+
+	/** @see OnEventBasesReset() */
+	FSimpleMulticastDelegate EventBasesReset;
+
+	/**
+	 * The loaded ExpiredEventBases which are not initialized with their core event yet,
+	 * so the timeline doesn't read their records. @see ResolveExpiredEventBase()
+	 */
+	mutable TSet<FGuid> UnresolvedExpiredEventBases;
+
+	/** The time of the timeline when UnresolvedExpiredEventBases have been loaded */
+	float ExpiredEventBasesLoadTime = 0.f;
+
+	/** true if OnBPEventChanged() is implemented in blueprint, it is computed in Init() and when blueprints are recompiled */
+	bool bHasBPEventChanged = false;
+
+	/**
+	 * Wraps the events queued by EnqueueNewEvent() or EnqueueAttach() in a UNEventBase before they are attached,
+	 * like CreateAndAddNewEvent() does.
+	 */
+	virtual bool AttachSubmission(const TSharedPtr<INEvent>& Event) override;
+
+	/** Saves or loads EventBases & ExpiredEventBases as they were before ENTimelineArchiveVersion::Compact. */
+	void SerializeLegacyEventBases(FArchive& Ar);
+
+	/** Computes bHasBPEventChanged */
+	void UpdateHasBPEventChanged();
+
+	/**
+	 * Initializes a loaded expired event with its core event the first time it is accessed.
+	 * @returns the expired event, nullptr if it doesn't exist or its core event can't be found
+	 */
+	UNEventBase* ResolveExpiredEventBase(const FGuid& UID) const;
+
+	/** @returns a pooled event of this class or a new one */
+	UNEventBase* AcquireEventBase(UClass* Class);
+
+	/**
+	 * Clears an expired event and puts it in the pool.
+	 * @returns false if pooling is disabled or the pools are full
+	 */
+	bool ReleaseEventBase(UNEventBase* EventBase, const float& LocalTime);
 };
@@ -18,6 +18,8 @@
 
 NANSTIMELINESYSTEMUE4_API DECLARE_LOG_CATEGORY_EXTERN(LogTimelineSystem, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("NansTimeline"), STATGROUP_NansTimeline, STATCAT_Advanced);
+
 #define UE_DEBUG_LOG(CategoryName, Verbosity, Format, ...) \
 if (bDebug) {\
 UE_LOG(CategoryName, Verbosity, Format, ##__VA_ARGS__); \
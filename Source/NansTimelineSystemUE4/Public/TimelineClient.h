@@ -21,6 +21,7 @@
 #include "TimelineClient.generated.h"
 
 class UNTimelineManagerDecorator;
+class UNTimelineTickDriver;
 
 /**
  * This class should be used by your GameInstance object.
@@ -78,6 +79,10 @@ protected:
 	UPROPERTY(SkipSerialization)
 	TMap<FName, UNTimelineManagerDecorator*> TimelinesCollection;
 
+	/** Ticks the timelines of TimelinesCollection, null if UNTimelineConfig::bSharedTickDriver is false */
+	UPROPERTY(Transient)
+	UNTimelineTickDriver* TickDriver = nullptr;
+
 private:
 	/**
 	 * This is just an helper for the savegame.
@@ -0,0 +1,101 @@
+// Copyright 2020-present Nans Pellicari (nans.pellicari@gmail.com).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Tickable.h"
+#include "TimelineManager.h"
+
+#include "TimelineTickDriver.generated.h"
+
+class UNTimelineManagerDecorator;
+
+/** The driven managers of one tick interval. @see UNTimelineTickDriver */
+USTRUCT()
+struct FNTimelineTickGroup
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	float TickInterval = 0.f;
+
+	/** In registration order */
+	UPROPERTY()
+	TArray<UNTimelineManagerDecorator*> Managers;
+};
+
+/**
+ * Ticks many timeline managers in one pass, instead of each manager registering its own timer or tickable.
+ * Managers are grouped by tick interval and ticked by ascending interval then by registration order,
+ * so the order is the same at every frame.
+ * Their timelines can be ticked in parallel, @see bParallelTick
+ *
+ * @see UNTimelineManagerDecorator::SetTickDriven()
+ */
+UCLASS()
+class NANSTIMELINESYSTEMUE4_API UNTimelineTickDriver : public UObject, public FTickableGameObject
+{
+	GENERATED_BODY()
+public:
+	/** Ticks this manager from now on, it stops its own tick registration. */
+	void Register(UNTimelineManagerDecorator* Manager);
+
+	/**
+	 * Stops ticking this manager.
+	 *
+	 * @param Manager - The manager to stop ticking
+	 * @param bGiveBackTick - Gives back its own tick registration to the manager, false when it is about to be destroyed
+	 */
+	void Unregister(UNTimelineManagerDecorator* Manager, const bool& bGiveBackTick = true);
+
+	/** @returns the number of registered managers */
+	int32 Num() const;
+
+	/**
+	 * When true, the timelines due at the same frame are ticked in parallel, their events are still notified
+	 * on the game thread in the same order. @see FNTimelineManager::TickInParallel()
+	 */
+	UPROPERTY()
+	bool bParallelTick = false;
+
+	// BEGIN FTickableGameObject override
+	/** Ticks every registered managers which consume a delta. @see UNTimelineManagerDecorator::ConsumeTickDelta() */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Each manager checks its own time, so real life managers keep ticking when the game is paused. */
+	virtual bool IsTickableWhenPaused() const override
+	{
+		return true;
+	}
+
+	virtual bool IsTickable() const override;
+
+	virtual TStatId GetStatId() const override;
+
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+	// END FTickableGameObject override
+
+	virtual void BeginDestroy() override;
+
+protected:
+	/** Sorted by ascending TickInterval */
+	UPROPERTY()
+	TArray<FNTimelineTickGroup> Groups;
+
+	/** The managers to tick at this frame, serially or in parallel, kept to reuse its allocation */
+	TArray<FNTimelineTickRequest> Requests;
+};